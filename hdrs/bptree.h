@@ -0,0 +1,99 @@
+// This file is part of keepcoding_core
+// ==================================
+//
+// bptree.h
+//
+// Copyright (c) 2024 Daniel Tanase
+// SPDX-License-Identifier: MIT License
+
+/*
+ * The B+ Tree structure keeps its items ordered, just like the Binary Tree,
+ * but every Node holds up to KC_BPTREE_ORDER items stored one after another.
+ * A search goes through a few wide Nodes instead of one Node per level, so it
+ * takes far fewer cache misses, which matters for collections with millions
+ * of items.
+ *
+ * Only the leaves hold the items, the inner Nodes hold copies of some of them
+ * to guide the searches. The Nodes of every level are linked to each other,
+ * so "range" walks the items in [low, high) in order, calling the callback for
+ * each of them until it returns something other than zero. Because the items
+ * are stored inline, all of them must have the same size, which is specified
+ * when creating the B+ Tree.
+ *
+ * When creating a B+ Tree, users need to define their own comparison function,
+ * the COMPARE_BPTREE macro provides a generic one. The B+ Tree shares the
+ * insert, remove and search shape of the Tree, except that search returns a
+ * reference to the stored item, which is only valid until the next insert or
+ * remove.
+ *
+ * To create and destroy instances of the B+ Tree struct, it is recommended
+ * to use the constructor and destructor functions.
+ *
+ * It's important to note that when using member functions, a reference to the
+ * B+ Tree instance needs to be passed, similar to how "self" is passed to
+ * class member functions in Python. This allows for accessing and manipulating
+ * the B+ Tree object's data and behavior.
+ */
+
+#ifndef KC_BPTREE_T_H
+#define KC_BPTREE_T_H
+
+#include "../system/logger.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+
+//---------------------------------------------------------------------------//
+
+#define KC_BPTREE_LOG_PATH  "build/log/bptree.log"
+#define KC_BPTREE_ORDER     32
+
+//---------------------------------------------------------------------------//
+
+struct kc_bptree_node_t
+{
+  struct kc_bptree_node_t* next;
+  struct kc_bptree_node_t* prev;
+  size_t                   count;
+  bool                     leaf;
+};
+
+struct kc_bptree_t
+{
+  struct kc_bptree_node_t* root;
+  struct kc_logger_t*      _logger;
+  size_t                   _elem_size;
+  size_t                   _keys_offset;
+  size_t                   _children_offset;
+  size_t                   _length;
+
+  int (*compare)  (const void* a, const void* b);
+  int (*insert)   (struct kc_bptree_t* self, void* data, size_t size);
+  int (*length)   (struct kc_bptree_t* self, size_t* length);
+  int (*range)    (struct kc_bptree_t* self, void* low, void* high, int (*callback)(void* data, void* context), void* context);
+  int (*remove)   (struct kc_bptree_t* self, void* data, size_t size);
+  int (*search)   (struct kc_bptree_t* self, void* data, void** found);
+};
+
+struct kc_bptree_t* new_bptree      (int (*compare)(const void* a, const void* b), size_t elem_size);
+void                destroy_bptree  (struct kc_bptree_t* bptree);
+
+//---------------------------------------------------------------------------//
+
+#define COMPARE_BPTREE(type, function_name)         \
+  int function_name(const void* a, const void* b)   \
+  {                                                 \
+    if (*(type*)a < *(type*)b)                      \
+    {                                               \
+      return -1;                                    \
+    }                                               \
+    if (*(type*)a > *(type*)b)                      \
+    {                                               \
+      return 1;                                     \
+    }                                               \
+    return 0;                                       \
+  }
+
+//---------------------------------------------------------------------------//
+
+#endif /* KC_BPTREE_T_H */
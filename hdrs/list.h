@@ -15,7 +15,34 @@
  * The List object simplifies the process of creating and destroying
  * nodes automatically, enabling users to focus on inserting their desired data.
  * To accommodate various data types, node data is stored as void pointers,
- * requiring appropriate casting when accessed.
+ * requiring appropriate casting when accessed. The nodes are taken from Node
+ * Pools owned by the List, so they are allocated in chunks and reused.
+ *
+ * To avoid walking the whole chain when accessing the Nodes by index, the
+ * List is also an indexable skip list: a random part of the Nodes (one in
+ * four, one in sixteen, and so on) are linked on higher levels as well, with
+ * every link knowing how many Nodes it skips. This way "get", "insert" and
+ * "erase" by index take O(log n) on average, while pushing and popping at
+ * both ends still takes O(1). The List keeps a Node Pool for every height of
+ * the Nodes, which stores the links right after the Node, so linking a Node
+ * on more levels doesn't allocate any more memory.
+ *
+ * When scanning the List and editing it along the way, a Cursor should be
+ * used instead of the indexes. A Cursor points to a Node (or past the tail)
+ * and knows its index, so "insert_before", "insert_after" and "erase_at"
+ * only relink the Nodes around it in O(1). The skip list is then rebuilt
+ * once, the next time an index is used.
+ *
+ * Nodes can also be moved from one List to another without copying them:
+ * "concat" moves all the Nodes of the other List after the tail, "splice"
+ * moves the Nodes between two Cursors of the other List before a Cursor, and
+ * "split" moves the Nodes from a Cursor to the tail at the end of the other
+ * List. The Lists join their Node Pools for that, so their memory is released
+ * only when both of them are destroyed.
+ *
+ * The "sort" function orders the Nodes with a stable merge sort that relinks
+ * them in place, so it doesn't allocate nor copy any data. The Nodes that
+ * compare equal keep the order they had before.
  *
  * To create and destroy instances of the List struct, it is recommended
  * to use the constructor and destructor functions.
@@ -33,36 +60,83 @@
 #include "node.h"
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
 //---------------------------------------------------------------------------//
 
-#define KC_LIST_LOG_PATH  "build/log/list.log"
+#define KC_LIST_LOG_PATH   "build/log/list.log"
+#define KC_LIST_MAX_LEVEL  16
 
 //---------------------------------------------------------------------------//
 
+struct kc_list_link_t
+{
+  struct kc_node_t* next;
+  struct kc_node_t* prev;
+  size_t            width;
+};
+
+struct kc_list_node_t
+{
+  struct kc_node_t      node;
+  size_t                height;
+  struct kc_list_link_t links[];
+};
+
+struct kc_list_lane_t
+{
+  struct kc_node_t* first;
+  struct kc_node_t* last;
+  size_t            first_pos;
+  size_t            last_pos;
+};
+
+struct kc_list_cursor_t
+{
+  struct kc_node_t* node;
+  size_t            index;
+};
+
 struct kc_list_t
 {
-  struct kc_node_t*   _head;
-  struct kc_node_t*   _tail;
-  struct kc_logger_t* _logger;
+  struct kc_node_t*      _head;
+  struct kc_node_t*      _tail;
+  struct kc_logger_t*    _logger;
+  struct kc_node_pool_t* _pools[KC_LIST_MAX_LEVEL];
+
+  struct kc_list_lane_t  _lanes[KC_LIST_MAX_LEVEL - 1];
+  size_t                 _levels;
+  size_t                 _base;
+  uint64_t               _seed;
+  bool                   _stale;
 
   size_t length;
 
-  int (*back)        (struct kc_list_t* self, struct kc_node_t** back_node);
-  int (*clear)       (struct kc_list_t* self);
-  int (*empty)       (struct kc_list_t* self, bool* is_empty);
-  int (*erase)       (struct kc_list_t* self, int index);
-  int (*front)       (struct kc_list_t* self, struct kc_node_t** front_node);
-  int (*get)         (struct kc_list_t* self, int index, struct kc_node_t** node);
-  int (*insert)      (struct kc_list_t* self, int index, void* data, size_t size);
-  int (*pop_back)    (struct kc_list_t* self);
-  int (*pop_front)   (struct kc_list_t* self);
-  int (*push_back)   (struct kc_list_t* self, void* data, size_t size);
-  int (*push_front)  (struct kc_list_t* self, void* data, size_t size);
-  int (*remove)      (struct kc_list_t* self, void* value, int (*compare)(const void* a, const void* b));
-  int (*search)      (struct kc_list_t* self, void* value, int (*compare)(const void* a, const void* b), bool* exists);
+  int (*back)          (struct kc_list_t* self, struct kc_node_t** back_node);
+  int (*clear)         (struct kc_list_t* self);
+  int (*concat)        (struct kc_list_t* self, struct kc_list_t* other);
+  int (*cursor)        (struct kc_list_t* self, int index, struct kc_list_cursor_t* cursor);
+  int (*cursor_next)   (struct kc_list_t* self, struct kc_list_cursor_t* cursor);
+  int (*cursor_prev)   (struct kc_list_t* self, struct kc_list_cursor_t* cursor);
+  int (*empty)         (struct kc_list_t* self, bool* is_empty);
+  int (*erase)         (struct kc_list_t* self, int index);
+  int (*erase_at)      (struct kc_list_t* self, struct kc_list_cursor_t* cursor);
+  int (*front)         (struct kc_list_t* self, struct kc_node_t** front_node);
+  int (*get)           (struct kc_list_t* self, int index, struct kc_node_t** node);
+  int (*insert)        (struct kc_list_t* self, int index, void* data, size_t size);
+  int (*insert_after)  (struct kc_list_t* self, struct kc_list_cursor_t* cursor, void* data, size_t size);
+  int (*insert_before) (struct kc_list_t* self, struct kc_list_cursor_t* cursor, void* data, size_t size);
+  int (*pop_back)      (struct kc_list_t* self);
+  int (*pop_front)     (struct kc_list_t* self);
+  int (*push_back)     (struct kc_list_t* self, void* data, size_t size);
+  int (*push_front)    (struct kc_list_t* self, void* data, size_t size);
+  int (*remove)        (struct kc_list_t* self, void* value, int (*compare)(const void* a, const void* b));
+  int (*search)        (struct kc_list_t* self, void* value, int (*compare)(const void* a, const void* b), bool* exists);
+  int (*sort)          (struct kc_list_t* self, int (*compare)(const void* a, const void* b));
+  int (*splice)        (struct kc_list_t* self, struct kc_list_cursor_t* cursor, struct kc_list_t* other, struct kc_list_cursor_t* first, struct kc_list_cursor_t* last);
+  int (*split)         (struct kc_list_t* self, struct kc_list_cursor_t* cursor, struct kc_list_t* other);
 };
 
 struct kc_list_t* new_list      ();
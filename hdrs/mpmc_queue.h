@@ -0,0 +1,76 @@
+// This file is part of keepcoding_core
+// ==================================
+//
+// mpmc_queue.h
+//
+// Copyright (c) 2024 Daniel Tanase
+// SPDX-License-Identifier: MIT License
+
+/*
+ * The MPMC Queue is a bounded FIFO (first-in first-out) queue that can be
+ * shared by any number of producer and consumer threads without locks.
+ *
+ * The items are copied into a circular buffer of fixed size cells, so both
+ * the capacity and the size of the items must be specified when creating the
+ * queue. The capacity is rounded up to the next power of two, and at least
+ * two cells are used. Every cell has a sequence number that tells the threads
+ * whether the cell is ready to be written or read, so the threads only compete
+ * for the position counters, which live on separate cache lines.
+ *
+ * The try_push and try_pop methods never wait, and report whether the item
+ * was moved, since the queue might be full (or empty). The push and pop
+ * methods wait until there is room for the item (or an item to take).
+ *
+ * To create and destroy instances of the MPMC Queue struct, it is recommended
+ * to use the constructor and destructor functions.
+ *
+ * It's important to note that when using member functions, a reference to the
+ * MPMC Queue instance needs to be passed, similar to how "self" is passed to
+ * class member functions in Python. This allows for accessing and manipulating
+ * the MPMC Queue object's data and behavior.
+ */
+
+#ifndef KC_MPMC_QUEUE_T_H
+#define KC_MPMC_QUEUE_T_H
+
+#include "../system/logger.h"
+
+#include "spsc_queue.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+//---------------------------------------------------------------------------//
+
+#define KC_MPMC_QUEUE_LOG_PATH  "build/log/mpmc_queue.log"
+
+//---------------------------------------------------------------------------//
+
+struct kc_mpmc_queue_t
+{
+  // shared by the producers
+  _Alignas(KC_CACHE_LINE_SIZE) atomic_size_t _tail;
+
+  // shared by the consumers
+  _Alignas(KC_CACHE_LINE_SIZE) atomic_size_t _head;
+
+  _Alignas(KC_CACHE_LINE_SIZE) unsigned char* _cells;
+  size_t              _capacity;
+  size_t              _cell_size;
+  size_t              _elem_size;
+  struct kc_logger_t* _logger;
+
+  int (*length)    (struct kc_mpmc_queue_t* self, size_t* length);
+  int (*pop)       (struct kc_mpmc_queue_t* self, void* data);
+  int (*push)      (struct kc_mpmc_queue_t* self, void* data);
+  int (*try_pop)   (struct kc_mpmc_queue_t* self, void* data, bool* popped);
+  int (*try_push)  (struct kc_mpmc_queue_t* self, void* data, bool* pushed);
+};
+
+struct kc_mpmc_queue_t* new_mpmc_queue      (size_t capacity, size_t elem_size);
+void                    destroy_mpmc_queue  (struct kc_mpmc_queue_t* queue);
+
+//---------------------------------------------------------------------------//
+
+#endif /* KC_MPMC_QUEUE_T_H */
@@ -18,8 +18,23 @@
  * allocation is necessary using the "Special" data type.
  *
  * To properly deallocate a Node, it is recommended to use the node destructor.
- * This destructor will automatically free both the stored data and the Node
- * itself.
+ * The data is stored right after the Node, in the same block of memory, so
+ * reaching it doesn't require another allocation nor another cache miss, and
+ * the destructor frees both of them at once.
+ *
+ * Containers that create and destroy many Nodes can take them from a Node
+ * Pool instead, which allocates the Nodes in chunks and keeps the released
+ * ones in a free list to be reused. Every slot of a Pool has room for up to
+ * KC_NODE_INLINE_SIZE bytes of data after the Node, only bigger data is
+ * allocated on its own. The Nodes taken from a Pool must be released with the
+ * pooled node destructor, and all of them are freed at once when the Pool is
+ * cleared or destroyed, after their data is freed with pooled_node_free_data.
+ *
+ * Containers that move Nodes between each other join their Pools. The joined
+ * Pools keep handing out and taking back Nodes on their own, but their chunks
+ * are only freed when the last of them is destroyed, since any of the chunks
+ * may hold Nodes used by any of the containers. For the same reason, clearing
+ * a joined Pool does nothing, its Nodes must be released one by one.
  */
 
 #ifndef KC_NODE_T_H
@@ -31,7 +46,9 @@
 
 //---------------------------------------------------------------------------//
 
-#define KC_NODE_LOG_PATH  "build/log/node.log"
+#define KC_NODE_LOG_PATH        "build/log/node.log"
+#define KC_NODE_POOL_CHUNK_SIZE  64
+#define KC_NODE_INLINE_SIZE      32
 
 //---------------------------------------------------------------------------//
 
@@ -43,9 +60,31 @@ struct kc_node_t
   void* data;
 };
 
+struct kc_node_pool_t
+{
+  struct kc_node_pool_t* _parent;
+  struct kc_node_pool_t* _joined;
+  struct kc_node_pool_t* _sibling;
+
+  void*  _chunks;
+  void*  _free;
+  size_t _node_size;
+  size_t _slot_size;
+  size_t _refs;
+};
+
 struct kc_node_t* node_constructor  (void* data, size_t size);
 void              node_destructor   (struct kc_node_t* node);
 
+struct kc_node_pool_t* new_node_pool       (size_t node_size);
+void                   clear_node_pool     (struct kc_node_pool_t* pool);
+void                   destroy_node_pool   (struct kc_node_pool_t* pool);
+int                    join_node_pools     (struct kc_node_pool_t* pool, struct kc_node_pool_t* other);
+
+struct kc_node_t* pooled_node_constructor  (struct kc_node_pool_t* pool, void* data, size_t size);
+void              pooled_node_destructor   (struct kc_node_pool_t* pool, struct kc_node_t* node);
+void              pooled_node_free_data    (struct kc_node_pool_t* pool, struct kc_node_t* node);
+
 //---------------------------------------------------------------------------//
 
 #endif /* KC_NODE_T_H */
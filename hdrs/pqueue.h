@@ -0,0 +1,85 @@
+// This file is part of keepcoding_core
+// ==================================
+//
+// pqueue.h
+//
+// Copyright (c) 2024 Daniel Tanase
+// SPDX-License-Identifier: MIT License
+
+/*
+ * The Priority Queue struct is a container that always gives access to its
+ * greatest item, as defined by the comparison function provided by the user.
+ * To get the smallest item instead, simply invert the comparison function.
+ *
+ * The items are kept in a Vector that stores them one after another, arranged
+ * as a heap where every item has up to four children that are not greater
+ * than itself. This way, push and pop take O(log n) time and top takes O(1).
+ * Because of that, all the items of a Priority Queue must have the same size,
+ * which is specified when creating the Priority Queue.
+ *
+ * A Priority Queue can also be created from an existing Vector of items (one
+ * created with "new_vector_of"), in which case the items are copied and
+ * arranged in O(n) time, which is faster than pushing them one by one.
+ *
+ * To create and destroy instances of the Priority Queue struct, it is
+ * recommended to use the constructor and destructor functions.
+ *
+ * It's important to note that when using member functions, a reference to the
+ * Priority Queue instance needs to be passed, similar to how "self" is passed
+ * to class member functions in Python. This allows for accessing and
+ * manipulating the Priority Queue object's data and behavior.
+ */
+
+#ifndef KC_PQUEUE_T_H
+#define KC_PQUEUE_T_H
+
+#include "../system/logger.h"
+
+#include "vector.h"
+
+#include <stdio.h>
+
+//---------------------------------------------------------------------------//
+
+#define KC_PQUEUE_LOG_PATH  "build/log/pqueue.log"
+#define KC_PQUEUE_ARITY     4
+
+//---------------------------------------------------------------------------//
+
+struct kc_pqueue_t
+{
+  struct kc_vector_t* _vector;
+  struct kc_logger_t* _logger;
+  void*               _item;
+
+  int (*compare)  (const void* a, const void* b);
+  int (*length)   (struct kc_pqueue_t* self, size_t* length);
+  int (*pop)      (struct kc_pqueue_t* self);
+  int (*push)     (struct kc_pqueue_t* self, void* data, size_t size);
+  int (*push_n)   (struct kc_pqueue_t* self, void* data, size_t count);
+  int (*top)      (struct kc_pqueue_t* self, void** top);
+};
+
+struct kc_pqueue_t* new_pqueue              (int (*compare)(const void* a, const void* b), size_t elem_size);
+struct kc_pqueue_t* new_pqueue_from_vector  (int (*compare)(const void* a, const void* b), struct kc_vector_t* vector);
+void                destroy_pqueue          (struct kc_pqueue_t* pqueue);
+
+//---------------------------------------------------------------------------//
+
+#define COMPARE_PQUEUE(type, function_name)         \
+  int function_name(const void* a, const void* b)   \
+  {                                                 \
+    if (*(type*)a < *(type*)b)                      \
+    {                                               \
+      return -1;                                    \
+    }                                               \
+    if (*(type*)a > *(type*)b)                      \
+    {                                               \
+      return 1;                                     \
+    }                                               \
+    return 0;                                       \
+  }
+
+//---------------------------------------------------------------------------//
+
+#endif /* KC_PQUEUE_T_H */
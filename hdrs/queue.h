@@ -14,6 +14,12 @@
  * implemented in the Queue struct primarily make use of the corresponding
  * methods in List in a predefined manner.
  *
+ * Since every item of the List is a separate allocation, a Queue can also be
+ * created with "new_ring_queue", which copies the items one after another
+ * into a single circular buffer that only grows when it gets full. Once the
+ * buffer is large enough, pushing and popping items don't allocate memory
+ * anymore. Both queues share the same interface.
+ *
  * To create and destroy instances of the List struct, it is recommended
  * to use the constructor and destructor functions.
  *
@@ -30,6 +36,7 @@
 
 #include "list.h"
 
+#include <stdbool.h>
 #include <stdio.h>
 
 //---------------------------------------------------------------------------//
@@ -43,14 +50,23 @@ struct kc_queue_t
   struct kc_list_t*   _list;
   struct kc_logger_t* _logger;
 
+  unsigned char* _buffer;
+  size_t         _capacity;
+  size_t         _head;
+  size_t         _tail;
+  size_t         _end;
+  size_t         _length;
+  bool           _wrapped;
+
   int (*length)  (struct kc_queue_t* self, size_t* length);
   int (*peek)    (struct kc_queue_t* self, void** peek);
   int (*pop)     (struct kc_queue_t* self);
   int (*push)    (struct kc_queue_t* self, void* data, size_t size);
 };
 
-struct kc_queue_t* new_queue      ();
-void               destroy_queue  (struct kc_queue_t* queue);
+struct kc_queue_t* new_queue       ();
+struct kc_queue_t* new_ring_queue  ();
+void               destroy_queue   (struct kc_queue_t* queue);
 
 //---------------------------------------------------------------------------//
 
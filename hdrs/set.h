@@ -17,6 +17,24 @@
  *
  * It is important to note that sets are containers that store unique elements.
  *
+ * A Set created with "new_set" keeps its pairs ordered in a balanced Tree, so
+ * every operation takes O(log n) comparisons. When the order of the keys is
+ * not important, use "new_hash_set" instead, which stores the pairs in an open
+ * addressing hash table (probing 16 control bytes at a time) and takes O(1)
+ * on average. The hash function receives the raw key, if NULL is passed, the
+ * bytes of the key will be hashed. Both sets share the same interface.
+ *
+ * The pairs of an ordered Set can be walked in order of their keys with the
+ * same functions the Tree offers ("first", "last", "next", "prev",
+ * "lower_bound", "upper_bound" and "range"), where the data of every Node is
+ * the kc_pair_t holding the key and the value. A hash Set has no order, so
+ * these functions return KC_INVALID for it.
+ *
+ * An ordered Set can also be built at once with "new_set_from_sorted", from an
+ * array of keys that are already sorted, without duplicates, and an array of
+ * their values, both with items of a fixed size. The pairs are arranged in a
+ * balanced Tree in O(n) time.
+ *
  * To create and destroy instances of the Set struct, it is recommended
  * to use the constructor and destructor functions.
  *
@@ -34,6 +52,7 @@
 #include "tree.h"
 #include "pair.h"
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -44,18 +63,42 @@
 
 //---------------------------------------------------------------------------//
 
+struct kc_set_slot_t
+{
+  struct kc_pair_t pair;
+  size_t           hash;
+};
+
 struct kc_set_t
 {
   struct kc_tree_t*   _entries;
   struct kc_logger_t* _logger;
 
-  int (*insert)  (struct kc_set_t* self, void* key, size_t key_size, void* value, size_t value_size);
-  int (*remove)  (struct kc_set_t* self, void* key, size_t key_size);
-  int (*search)  (struct kc_set_t* self, void* key, size_t key_size, void** value);
+  int8_t*               _control;
+  struct kc_set_slot_t* _slots;
+  size_t                _capacity;
+  size_t                _growth_left;
+  size_t                _length;
+
+  int    (*_compare)  (const void* a, const void* b);
+  size_t (*_hash)     (const void* key, size_t key_size);
+
+  int (*first)        (struct kc_set_t* self, struct kc_node_t** node);
+  int (*insert)       (struct kc_set_t* self, void* key, size_t key_size, void* value, size_t value_size);
+  int (*last)         (struct kc_set_t* self, struct kc_node_t** node);
+  int (*lower_bound)  (struct kc_set_t* self, void* key, struct kc_node_t** node);
+  int (*next)         (struct kc_set_t* self, struct kc_node_t** node);
+  int (*prev)         (struct kc_set_t* self, struct kc_node_t** node);
+  int (*range)        (struct kc_set_t* self, void* low, void* high, int (*callback)(void* key, void* value, void* context), void* context);
+  int (*remove)       (struct kc_set_t* self, void* key, size_t key_size);
+  int (*search)       (struct kc_set_t* self, void* key, size_t key_size, void** value);
+  int (*upper_bound)  (struct kc_set_t* self, void* key, struct kc_node_t** node);
 };
 
-struct kc_set_t* new_set      (int (*compare)(const void* a, const void* b));
-void             destroy_set  (struct kc_set_t* set);
+struct kc_set_t* new_set              (int (*compare)(const void* a, const void* b));
+struct kc_set_t* new_set_from_sorted  (int (*compare)(const void* a, const void* b), void* keys, void* values, size_t count, size_t key_size, size_t value_size);
+struct kc_set_t* new_hash_set         (size_t (*hash)(const void* key, size_t key_size), int (*compare)(const void* a, const void* b));
+void             destroy_set          (struct kc_set_t* set);
 
 //---------------------------------------------------------------------------//
 
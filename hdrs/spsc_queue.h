@@ -0,0 +1,74 @@
+// This file is part of keepcoding_core
+// ==================================
+//
+// spsc_queue.h
+//
+// Copyright (c) 2024 Daniel Tanase
+// SPDX-License-Identifier: MIT License
+
+/*
+ * The SPSC Queue is a bounded FIFO (first-in first-out) queue meant to pass
+ * items between exactly two threads: a single producer, which only pushes,
+ * and a single consumer, which only pops. The two threads never take a lock,
+ * they only publish their position in the queue through atomic counters.
+ *
+ * The items are copied into a circular buffer of fixed size slots, so both
+ * the capacity and the size of the items must be specified when creating the
+ * queue. The capacity is rounded up to the next power of two. The positions
+ * of the producer and the consumer live on separate cache lines, so the two
+ * threads don't slow each other down while working on different items.
+ *
+ * The push and pop methods work with batches of items, and report how many
+ * items were actually moved, since the queue might be full (or empty). To
+ * move a single item, simply use a count of one.
+ *
+ * To create and destroy instances of the SPSC Queue struct, it is recommended
+ * to use the constructor and destructor functions.
+ *
+ * It's important to note that when using member functions, a reference to the
+ * SPSC Queue instance needs to be passed, similar to how "self" is passed to
+ * class member functions in Python. This allows for accessing and manipulating
+ * the SPSC Queue object's data and behavior.
+ */
+
+#ifndef KC_SPSC_QUEUE_T_H
+#define KC_SPSC_QUEUE_T_H
+
+#include "../system/logger.h"
+
+#include <stdatomic.h>
+#include <stdio.h>
+
+//---------------------------------------------------------------------------//
+
+#define KC_SPSC_QUEUE_LOG_PATH  "build/log/spsc_queue.log"
+#define KC_CACHE_LINE_SIZE      64
+
+//---------------------------------------------------------------------------//
+
+struct kc_spsc_queue_t
+{
+  // written by the producer
+  _Alignas(KC_CACHE_LINE_SIZE) atomic_size_t _tail;
+  size_t _cached_head;
+
+  // written by the consumer
+  _Alignas(KC_CACHE_LINE_SIZE) atomic_size_t _head;
+  size_t _cached_tail;
+
+  _Alignas(KC_CACHE_LINE_SIZE) unsigned char* _buffer;
+  size_t              _capacity;
+  size_t              _elem_size;
+  struct kc_logger_t* _logger;
+
+  int (*length)  (struct kc_spsc_queue_t* self, size_t* length);
+  int (*pop)     (struct kc_spsc_queue_t* self, void* data, size_t count, size_t* popped);
+  int (*push)    (struct kc_spsc_queue_t* self, void* data, size_t count, size_t* pushed);
+};
+
+struct kc_spsc_queue_t* new_spsc_queue      (size_t capacity, size_t elem_size);
+void                    destroy_spsc_queue  (struct kc_spsc_queue_t* queue);
+
+//---------------------------------------------------------------------------//
+
+#endif /* KC_SPSC_QUEUE_T_H */
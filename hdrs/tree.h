@@ -19,6 +19,32 @@
  * To make things easier, there is a generic comparison function available
  * for users to utilize by important the COMPARE_TREE macro.
  *
+ * A Tree created with "new_tree" is a plain binary search tree, so inserting
+ * already sorted data will degenerate it into a linked list. For such cases,
+ * use "new_rb_tree" instead, which keeps the Tree balanced by following the
+ * red-black rules, guaranteeing O(log n) insert, remove and search regardless
+ * of the order of the data. Both trees share the same interface.
+ *
+ * A Tree can also be built at once from an array of items that are already
+ * sorted, without duplicates, with "new_tree_from_sorted". The Nodes are
+ * allocated in a single pass and arranged as a perfectly balanced red-black
+ * Tree in O(n) time, instead of the O(n log n) taken by inserting them one by
+ * one.
+ *
+ * The Nodes of a Tree can be walked in order without any allocation: "first"
+ * and "last" return the smallest and the greatest Node, while "next" and
+ * "prev" move a Node to its in-order neighbour, setting it to NULL at the end.
+ * "lower_bound" returns the first Node not smaller than the data, and
+ * "upper_bound" the first Node greater than it. "range" calls the callback for
+ * the data of every Node in [low, high), in order, until the callback returns
+ * something other than zero. Each of them takes O(log n + k).
+ *
+ * Every Node also counts the Nodes of its subtree, so the Tree answers order
+ * statistics: "rank" returns how many items are smaller than the data, and
+ * "select" returns the Node at the given position in order, starting from 0.
+ * Both take O(log n) on a red-black Tree, while "length" just reads the count
+ * of the root in O(1).
+ *
  * To create and destroy instances of the Tree struct, it is recommended
  * to use the constructor and destructor functions.
  *
@@ -35,6 +61,7 @@
 
 #include "node.h"
 
+#include <stdbool.h>
 #include <stdio.h>
 
 //---------------------------------------------------------------------------//
@@ -43,19 +70,41 @@
 
 //---------------------------------------------------------------------------//
 
+struct kc_tree_node_t
+{
+  struct kc_node_t  node;
+  struct kc_node_t* parent;
+  size_t            count;
+
+  bool red;
+};
+
 struct kc_tree_t
 {
-  struct kc_node_t* root;
-  struct kc_logger_t* _logger;
+  struct kc_node_t*      root;
+  struct kc_logger_t*    _logger;
+  struct kc_node_pool_t* _pool;
 
-  int (*compare)  (const void* a, const void* b);
-  int (*insert)   (struct kc_tree_t* self, void* data, size_t size);
-  int (*remove)   (struct kc_tree_t* self, void* data, size_t size);
-  int (*search)   (struct kc_tree_t* self, void* data, struct kc_node_t** node);
+  int (*compare)      (const void* a, const void* b);
+  int (*first)        (struct kc_tree_t* self, struct kc_node_t** node);
+  int (*insert)       (struct kc_tree_t* self, void* data, size_t size);
+  int (*last)         (struct kc_tree_t* self, struct kc_node_t** node);
+  int (*length)       (struct kc_tree_t* self, size_t* length);
+  int (*lower_bound)  (struct kc_tree_t* self, void* data, struct kc_node_t** node);
+  int (*next)         (struct kc_tree_t* self, struct kc_node_t** node);
+  int (*prev)         (struct kc_tree_t* self, struct kc_node_t** node);
+  int (*range)        (struct kc_tree_t* self, void* low, void* high, int (*callback)(void* data, void* context), void* context);
+  int (*rank)         (struct kc_tree_t* self, void* data, size_t* rank);
+  int (*remove)       (struct kc_tree_t* self, void* data, size_t size);
+  int (*search)       (struct kc_tree_t* self, void* data, struct kc_node_t** node);
+  int (*select)       (struct kc_tree_t* self, size_t index, struct kc_node_t** node);
+  int (*upper_bound)  (struct kc_tree_t* self, void* data, struct kc_node_t** node);
 };
 
-struct kc_tree_t* new_tree      (int (*compare)(const void* a, const void* b));
-void              destroy_tree  (struct kc_tree_t* tree);
+struct kc_tree_t* new_tree              (int (*compare)(const void* a, const void* b));
+struct kc_tree_t* new_rb_tree           (int (*compare)(const void* a, const void* b));
+struct kc_tree_t* new_tree_from_sorted  (int (*compare)(const void* a, const void* b), void* array, size_t count, size_t elem_size);
+void              destroy_tree          (struct kc_tree_t* tree);
 
 //---------------------------------------------------------------------------//
 
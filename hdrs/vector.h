@@ -18,6 +18,38 @@
  * vector ensures efficient memory utilization and facilitates dynamic data
  * storage, retrieval, and modification.
  *
+ * By default, every element is copied into its own block of memory and the
+ * vector stores a pointer to it. When all the elements have the same size,
+ * use "new_vector_of" instead, which copies the elements one after another
+ * into a single buffer, so "data" must be cast to the type of the elements.
+ * In both cases, the at(), front() and back() methods return a pointer to the
+ * element.
+ *
+ * The elements removed from the front leave a gap before "data", which is
+ * reused by the elements pushed to the front, so both ends of the Vector
+ * take amortized O(1) and it can be used as a sliding window. "data" always
+ * points to the first element, and the capacity counts the gap as well.
+ *
+ * When full, the capacity is multiplied by the growth factor, 2 by default,
+ * which can be changed with "set_growth". It is halved only once the length
+ * drops under a quarter of it, so pushing and popping around the same length
+ * doesn't reallocate the buffer every time. To avoid reallocations entirely,
+ * "reserve" grows the capacity up front, without ever shrinking it, while
+ * "shrink_to_fit" releases all the unused capacity.
+ *
+ * Many elements of the same size, stored one after another, are added at
+ * once with "append_n" and "insert_range", which grow the capacity and move
+ * the following elements only once, instead of once for every element.
+ * Likewise, "remove_if" removes all the elements matching a predicate in a
+ * single pass, sliding the others into place as it goes.
+ *
+ * The first KC_VECTOR_SMALL_CAPACITY slots are stored inside the Vector
+ * struct itself, so small vectors don't allocate a separate buffer and their
+ * elements share the cache lines of the struct. The buffer is moved to the
+ * heap once it outgrows them, and moved back when the capacity drops again.
+ * Because "data" may point inside the struct, a Vector must not be copied by
+ * value.
+ *
  * To create and destroy instances of the Vector struct, it is recommended
  * to use the constructor and destructor functions.
  *
@@ -33,40 +65,54 @@
 #include "../system/logger.h"
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdio.h>
 
 //---------------------------------------------------------------------------//
 
-#define KC_VECTOR_LOG_PATH  "build/log/vector.log"
+#define KC_VECTOR_LOG_PATH        "build/log/vector.log"
+#define KC_VECTOR_SMALL_CAPACITY  16
 
 //---------------------------------------------------------------------------//
 
 struct kc_vector_t
 {
   size_t              _capacity;
+  size_t              _elem_size;
+  size_t              _front;
+  double              _growth;
   struct kc_logger_t* _logger;
 
+  _Alignas(max_align_t) void* _small[KC_VECTOR_SMALL_CAPACITY];
+
   void** data;
   size_t length;
 
-  int (*at)          (struct kc_vector_t* self, int index, void** at);
-  int (*back)        (struct kc_vector_t* self, void** back);
-  int (*clear)       (struct kc_vector_t* self);
-  int (*empty)       (struct kc_vector_t* self, bool* empty);
-  int (*erase)       (struct kc_vector_t* self, int index);
-  int (*front)       (struct kc_vector_t* self, void** front);
-  int (*insert)      (struct kc_vector_t* self, int index, void* data, size_t size);
-  int (*max_size)    (struct kc_vector_t* self, size_t* max_size);
-  int (*pop_back)    (struct kc_vector_t* self);
-  int (*pop_front)   (struct kc_vector_t* self);
-  int (*push_back)   (struct kc_vector_t* self, void* data, size_t size);
-  int (*push_front)  (struct kc_vector_t* self, void* data, size_t size);
-  int (*remove)      (struct kc_vector_t* self, void* value, int (*compare)(const void* a, const void* b));
-  int (*resize)      (struct kc_vector_t* self, size_t new_capacity);
-  int (*search)      (struct kc_vector_t* self, void* value, int (*compare)(const void* a, const void* b), bool* exists);
+  int (*append_n)      (struct kc_vector_t* self, void* data, size_t count, size_t elem_size);
+  int (*at)            (struct kc_vector_t* self, int index, void** at);
+  int (*back)          (struct kc_vector_t* self, void** back);
+  int (*clear)         (struct kc_vector_t* self);
+  int (*empty)         (struct kc_vector_t* self, bool* empty);
+  int (*erase)         (struct kc_vector_t* self, int index);
+  int (*front)         (struct kc_vector_t* self, void** front);
+  int (*insert)        (struct kc_vector_t* self, int index, void* data, size_t size);
+  int (*insert_range)  (struct kc_vector_t* self, int index, void* data, size_t count, size_t elem_size);
+  int (*max_size)      (struct kc_vector_t* self, size_t* max_size);
+  int (*pop_back)      (struct kc_vector_t* self);
+  int (*pop_front)     (struct kc_vector_t* self);
+  int (*push_back)     (struct kc_vector_t* self, void* data, size_t size);
+  int (*push_front)    (struct kc_vector_t* self, void* data, size_t size);
+  int (*remove)        (struct kc_vector_t* self, void* value, int (*compare)(const void* a, const void* b));
+  int (*remove_if)     (struct kc_vector_t* self, bool (*predicate)(const void* elem, void* context), void* context);
+  int (*reserve)       (struct kc_vector_t* self, size_t capacity);
+  int (*resize)        (struct kc_vector_t* self, size_t new_capacity);
+  int (*search)        (struct kc_vector_t* self, void* value, int (*compare)(const void* a, const void* b), bool* exists);
+  int (*set_growth)    (struct kc_vector_t* self, double factor);
+  int (*shrink_to_fit) (struct kc_vector_t* self);
 };
 
 struct kc_vector_t* new_vector      ();
+struct kc_vector_t* new_vector_of   (size_t elem_size);
 void                destroy_vector  (struct kc_vector_t* vector);
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,692 @@
+// This file is part of keepcoding_core
+// ==================================
+//
+// bptree.c
+//
+// Copyright (c) 2024 Daniel Tanase
+// SPDX-License-Identifier: MIT License
+
+#include "../../hdrs/datastructs/bptree.h"
+#include "../../hdrs/common.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//---------------------------------------------------------------------------//
+
+// every node but the root keeps at least half of the items, so the height
+// of the tree can't come anywhere close to the depth of the search paths
+#define KC_BPTREE_MIN_COUNT  (KC_BPTREE_ORDER / 2)
+#define KC_BPTREE_MAX_DEPTH  32
+
+//--- MARK: PUBLIC FUNCTION PROTOTYPES --------------------------------------//
+
+static int get_length_bptree    (struct kc_bptree_t* self, size_t* length);
+static int insert_item_bptree   (struct kc_bptree_t* self, void* data, size_t size);
+static int range_bptree         (struct kc_bptree_t* self, void* low, void* high, int (*callback)(void* data, void* context), void* context);
+static int remove_item_bptree   (struct kc_bptree_t* self, void* data, size_t size);
+static int search_item_bptree   (struct kc_bptree_t* self, void* data, void** found);
+
+//--- MARK: PRIVATE FUNCTION PROTOTYPES -------------------------------------//
+
+static void                      _borrow_from_left   (struct kc_bptree_t* bptree, struct kc_bptree_node_t* parent, size_t index);
+static void                      _borrow_from_right  (struct kc_bptree_t* bptree, struct kc_bptree_node_t* parent, size_t index);
+static struct kc_bptree_node_t** _children_of        (struct kc_bptree_t* bptree, struct kc_bptree_node_t* node);
+static size_t                    _find_path          (struct kc_bptree_t* bptree, void* data, struct kc_bptree_node_t** path, size_t* indexes);
+static void                      _insert_child       (struct kc_bptree_t* bptree, struct kc_bptree_node_t* parent, size_t index, void* separator, struct kc_bptree_node_t* child);
+static void*                     _key_at             (struct kc_bptree_t* bptree, struct kc_bptree_node_t* node, size_t index);
+static size_t                    _lower_index        (struct kc_bptree_t* bptree, struct kc_bptree_node_t* node, void* data);
+static void                      _merge_children     (struct kc_bptree_t* bptree, struct kc_bptree_node_t* parent, size_t index);
+static struct kc_bptree_node_t*  _new_bptree_node    (struct kc_bptree_t* bptree, bool leaf);
+static void*                     _split_node         (struct kc_bptree_t* bptree, struct kc_bptree_node_t* node, struct kc_bptree_node_t* right);
+static size_t                    _upper_index        (struct kc_bptree_t* bptree, struct kc_bptree_node_t* node, void* data);
+
+//---------------------------------------------------------------------------//
+
+struct kc_bptree_t* new_bptree(int (*compare)(const void* a, const void* b), size_t elem_size)
+{
+  if (elem_size < 1)
+  {
+    log_error(KC_UNDERFLOW_LOG);
+    return NULL;
+  }
+
+  // create a B+ Tree instance to be returned
+  struct kc_bptree_t* new_bptree = malloc(sizeof(struct kc_bptree_t));
+
+  // confirm that there is memory to allocate
+  if (new_bptree == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return NULL;
+  }
+
+  new_bptree->_logger = new_logger(KC_BPTREE_LOG_PATH);
+
+  if (new_bptree->_logger == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+
+    // free the instance
+    free(new_bptree);
+
+    return NULL;
+  }
+
+  // the items follow the node header and the children follow the items,
+  // every node has room for one extra item before it gets split
+  size_t align = 2 * sizeof(void*);
+  size_t keys  = (KC_BPTREE_ORDER + 1) * elem_size;
+
+  new_bptree->_elem_size       = elem_size;
+  new_bptree->_keys_offset     = (sizeof(struct kc_bptree_node_t) + align - 1) / align * align;
+  new_bptree->_children_offset = new_bptree->_keys_offset + (keys + align - 1) / align * align;
+  new_bptree->_length          = 0;
+  new_bptree->compare          = compare;
+
+  // an empty tree is a single empty leaf
+  new_bptree->root = _new_bptree_node(new_bptree, true);
+
+  if (new_bptree->root == NULL)
+  {
+    log_error(KC_OUT_OF_MEMORY_LOG);
+
+    destroy_logger(new_bptree->_logger);
+    free(new_bptree);
+
+    return NULL;
+  }
+
+  // assigns the public member methods
+  new_bptree->insert = insert_item_bptree;
+  new_bptree->length = get_length_bptree;
+  new_bptree->range  = range_bptree;
+  new_bptree->remove = remove_item_bptree;
+  new_bptree->search = search_item_bptree;
+
+  return new_bptree;
+}
+
+//---------------------------------------------------------------------------//
+
+void destroy_bptree(struct kc_bptree_t* bptree)
+{
+  // if the bptree reference is NULL, do nothing
+  if (bptree == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return;
+  }
+
+  // the nodes of every level are linked, so free them level by level
+  struct kc_bptree_node_t* level = bptree->root;
+
+  while (level != NULL)
+  {
+    struct kc_bptree_node_t* below = level->leaf ? NULL : _children_of(bptree, level)[0];
+
+    while (level != NULL)
+    {
+      struct kc_bptree_node_t* next = level->next;
+      free(level);
+      level = next;
+    }
+
+    level = below;
+  }
+
+  destroy_logger(bptree->_logger);
+  free(bptree);
+}
+
+//---------------------------------------------------------------------------//
+
+int get_length_bptree(struct kc_bptree_t* self, size_t* length)
+{
+  // if the bptree reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  (*length) = self->_length;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int insert_item_bptree(struct kc_bptree_t* self, void* data, size_t size)
+{
+  // if the bptree reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // the items are stored inline, so they must all have the same size
+  if (size != self->_elem_size)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INVALID,
+      __FILE__, __LINE__, __func__);
+
+    return KC_INVALID;
+  }
+
+  struct kc_bptree_node_t* path[KC_BPTREE_MAX_DEPTH];
+  size_t indexes[KC_BPTREE_MAX_DEPTH];
+
+  size_t depth = _find_path(self, data, path, indexes);
+  struct kc_bptree_node_t* leaf = path[depth];
+
+  size_t pos = _lower_index(self, leaf, data);
+
+  // the data is already in the tree
+  if (pos < leaf->count && self->compare(_key_at(self, leaf, pos), data) == 0)
+  {
+    return KC_SUCCESS;
+  }
+
+  // every full node on the way up will be split, allocate the new nodes
+  // before touching the tree, so running out of memory leaves it untouched
+  struct kc_bptree_node_t* spare[KC_BPTREE_MAX_DEPTH + 1];
+  size_t splits = 0;
+
+  for (size_t level = depth; path[level]->count == KC_BPTREE_ORDER; --level)
+  {
+    ++splits;
+
+    // splitting the root adds a new root on top of it
+    if (level == 0)
+    {
+      ++splits;
+      break;
+    }
+  }
+
+  for (size_t i = 0; i < splits; ++i)
+  {
+    spare[i] = _new_bptree_node(self, i == 0);
+
+    if (spare[i] == NULL)
+    {
+      while (i > 0)
+      {
+        free(spare[--i]);
+      }
+
+      self->_logger->log(self->_logger, KC_ERROR_LOG, KC_OUT_OF_MEMORY,
+        __FILE__, __LINE__, __func__);
+
+      return KC_OUT_OF_MEMORY;
+    }
+  }
+
+  // make room for the data inside the leaf
+  memmove(_key_at(self, leaf, pos + 1), _key_at(self, leaf, pos),
+    (leaf->count - pos) * self->_elem_size);
+  memcpy(_key_at(self, leaf, pos), data, self->_elem_size);
+
+  ++leaf->count;
+  ++self->_length;
+
+  // split the overflowing nodes from the bottom up
+  size_t level = depth;
+  size_t used  = 0;
+
+  while (path[level]->count > KC_BPTREE_ORDER)
+  {
+    struct kc_bptree_node_t* right = spare[used++];
+    void* separator = _split_node(self, path[level], right);
+
+    if (level == 0)
+    {
+      struct kc_bptree_node_t* root = spare[used++];
+
+      memcpy(_key_at(self, root, 0), separator, self->_elem_size);
+      _children_of(self, root)[0] = path[0];
+      _children_of(self, root)[1] = right;
+      root->count = 1;
+
+      self->root = root;
+
+      break;
+    }
+
+    _insert_child(self, path[level - 1], indexes[level - 1], separator, right);
+    --level;
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int range_bptree(struct kc_bptree_t* self, void* low, void* high,
+    int (*callback)(void* data, void* context), void* context)
+{
+  // if the bptree or the callback reference is NULL, do nothing
+  if (self == NULL || callback == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // go down to the leaf where the lower limit would be
+  struct kc_bptree_node_t* node = self->root;
+
+  while (node->leaf == false)
+  {
+    node = _children_of(self, node)[_upper_index(self, node, low)];
+  }
+
+  size_t pos = _lower_index(self, node, low);
+
+  // walk the linked leaves until the upper limit or until the callback
+  // stops it
+  while (node != NULL)
+  {
+    for (; pos < node->count; ++pos)
+    {
+      void* item = _key_at(self, node, pos);
+
+      if (self->compare(item, high) >= 0 || callback(item, context) != 0)
+      {
+        return KC_SUCCESS;
+      }
+    }
+
+    node = node->next;
+    pos  = 0;
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int remove_item_bptree(struct kc_bptree_t* self, void* data, size_t size)
+{
+  // if the bptree reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  struct kc_bptree_node_t* path[KC_BPTREE_MAX_DEPTH];
+  size_t indexes[KC_BPTREE_MAX_DEPTH];
+
+  size_t depth = _find_path(self, data, path, indexes);
+  struct kc_bptree_node_t* leaf = path[depth];
+
+  size_t pos = _lower_index(self, leaf, data);
+
+  // the data is not in the tree
+  if (pos == leaf->count || self->compare(_key_at(self, leaf, pos), data) != 0)
+  {
+    return KC_SUCCESS;
+  }
+
+  memmove(_key_at(self, leaf, pos), _key_at(self, leaf, pos + 1),
+    (leaf->count - pos - 1) * self->_elem_size);
+
+  --leaf->count;
+  --self->_length;
+
+  // refill the nodes left with less than half of the items from the bottom
+  // up, either from a sibling that can spare one or by merging with it
+  for (size_t level = depth; level > 0 && path[level]->count < KC_BPTREE_MIN_COUNT; --level)
+  {
+    struct kc_bptree_node_t*  parent   = path[level - 1];
+    struct kc_bptree_node_t** children = _children_of(self, parent);
+    size_t index = indexes[level - 1];
+
+    if (index > 0 && children[index - 1]->count > KC_BPTREE_MIN_COUNT)
+    {
+      _borrow_from_left(self, parent, index);
+      break;
+    }
+
+    if (index < parent->count && children[index + 1]->count > KC_BPTREE_MIN_COUNT)
+    {
+      _borrow_from_right(self, parent, index);
+      break;
+    }
+
+    _merge_children(self, parent, index > 0 ? index - 1 : index);
+  }
+
+  // the root is dropped once its last two children were merged
+  if (self->root->leaf == false && self->root->count == 0)
+  {
+    struct kc_bptree_node_t* root = self->root;
+
+    self->root = _children_of(self, root)[0];
+    free(root);
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int search_item_bptree(struct kc_bptree_t* self, void* data, void** found)
+{
+  // if the bptree reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  struct kc_bptree_node_t* node = self->root;
+
+  while (node->leaf == false)
+  {
+    node = _children_of(self, node)[_upper_index(self, node, data)];
+  }
+
+  size_t pos = _lower_index(self, node, data);
+
+  // return the stored item if it was found, NULL otherwise
+  if (pos < node->count && self->compare(_key_at(self, node, pos), data) == 0)
+  {
+    (*found) = _key_at(self, node, pos);
+  }
+  else
+  {
+    (*found) = NULL;
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+void _borrow_from_left(struct kc_bptree_t* bptree, struct kc_bptree_node_t* parent, size_t index)
+{
+  struct kc_bptree_node_t** children = _children_of(bptree, parent);
+  struct kc_bptree_node_t*  node     = children[index];
+  struct kc_bptree_node_t*  left     = children[index - 1];
+
+  size_t elem_size = bptree->_elem_size;
+
+  memmove(_key_at(bptree, node, 1), _key_at(bptree, node, 0), node->count * elem_size);
+
+  if (node->leaf)
+  {
+    // the last item of the left sibling becomes the first one of the node
+    memcpy(_key_at(bptree, node, 0), _key_at(bptree, left, left->count - 1), elem_size);
+    memcpy(_key_at(bptree, parent, index - 1), _key_at(bptree, node, 0), elem_size);
+  }
+  else
+  {
+    // rotate through the parent, the last child of the left sibling moves too
+    struct kc_bptree_node_t** node_children = _children_of(bptree, node);
+
+    memmove(node_children + 1, node_children, (node->count + 1) * sizeof(*node_children));
+    node_children[0] = _children_of(bptree, left)[left->count];
+
+    memcpy(_key_at(bptree, node, 0), _key_at(bptree, parent, index - 1), elem_size);
+    memcpy(_key_at(bptree, parent, index - 1), _key_at(bptree, left, left->count - 1), elem_size);
+  }
+
+  --left->count;
+  ++node->count;
+}
+
+//---------------------------------------------------------------------------//
+
+void _borrow_from_right(struct kc_bptree_t* bptree, struct kc_bptree_node_t* parent, size_t index)
+{
+  struct kc_bptree_node_t** children = _children_of(bptree, parent);
+  struct kc_bptree_node_t*  node     = children[index];
+  struct kc_bptree_node_t*  right    = children[index + 1];
+
+  size_t elem_size = bptree->_elem_size;
+
+  if (node->leaf)
+  {
+    // the first item of the right sibling becomes the last one of the node
+    memcpy(_key_at(bptree, node, node->count), _key_at(bptree, right, 0), elem_size);
+  }
+  else
+  {
+    // rotate through the parent, the first child of the right sibling moves too
+    struct kc_bptree_node_t** right_children = _children_of(bptree, right);
+
+    memcpy(_key_at(bptree, node, node->count), _key_at(bptree, parent, index), elem_size);
+    memcpy(_key_at(bptree, parent, index), _key_at(bptree, right, 0), elem_size);
+
+    _children_of(bptree, node)[node->count + 1] = right_children[0];
+    memmove(right_children, right_children + 1, right->count * sizeof(*right_children));
+  }
+
+  ++node->count;
+  --right->count;
+
+  memmove(_key_at(bptree, right, 0), _key_at(bptree, right, 1), right->count * elem_size);
+
+  if (node->leaf)
+  {
+    memcpy(_key_at(bptree, parent, index), _key_at(bptree, right, 0), elem_size);
+  }
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_bptree_node_t** _children_of(struct kc_bptree_t* bptree, struct kc_bptree_node_t* node)
+{
+  return (struct kc_bptree_node_t**)((unsigned char*)node + bptree->_children_offset);
+}
+
+//---------------------------------------------------------------------------//
+
+size_t _find_path(struct kc_bptree_t* bptree, void* data,
+    struct kc_bptree_node_t** path, size_t* indexes)
+{
+  size_t depth = 0;
+  path[0] = bptree->root;
+
+  // remember every node and the child taken on the way down to the leaf
+  while (path[depth]->leaf == false)
+  {
+    indexes[depth] = _upper_index(bptree, path[depth], data);
+    path[depth + 1] = _children_of(bptree, path[depth])[indexes[depth]];
+
+    ++depth;
+  }
+
+  return depth;
+}
+
+//---------------------------------------------------------------------------//
+
+void _insert_child(struct kc_bptree_t* bptree, struct kc_bptree_node_t* parent,
+    size_t index, void* separator, struct kc_bptree_node_t* child)
+{
+  struct kc_bptree_node_t** children = _children_of(bptree, parent);
+
+  // the new child goes right after the one that was split
+  memmove(_key_at(bptree, parent, index + 1), _key_at(bptree, parent, index),
+    (parent->count - index) * bptree->_elem_size);
+  memmove(children + index + 2, children + index + 1,
+    (parent->count - index) * sizeof(*children));
+
+  memcpy(_key_at(bptree, parent, index), separator, bptree->_elem_size);
+  children[index + 1] = child;
+
+  ++parent->count;
+}
+
+//---------------------------------------------------------------------------//
+
+void* _key_at(struct kc_bptree_t* bptree, struct kc_bptree_node_t* node, size_t index)
+{
+  return (unsigned char*)node + bptree->_keys_offset + index * bptree->_elem_size;
+}
+
+//---------------------------------------------------------------------------//
+
+size_t _lower_index(struct kc_bptree_t* bptree, struct kc_bptree_node_t* node, void* data)
+{
+  // binary search for the first item that is not smaller than the data
+  size_t low  = 0;
+  size_t high = node->count;
+
+  while (low < high)
+  {
+    size_t mid = low + (high - low) / 2;
+
+    if (bptree->compare(_key_at(bptree, node, mid), data) < 0)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+
+  return low;
+}
+
+//---------------------------------------------------------------------------//
+
+void _merge_children(struct kc_bptree_t* bptree, struct kc_bptree_node_t* parent, size_t index)
+{
+  struct kc_bptree_node_t** children = _children_of(bptree, parent);
+  struct kc_bptree_node_t*  left     = children[index];
+  struct kc_bptree_node_t*  right    = children[index + 1];
+
+  size_t elem_size = bptree->_elem_size;
+
+  // inner nodes take the separator from the parent, leaves only their items
+  if (left->leaf == false)
+  {
+    memcpy(_key_at(bptree, left, left->count), _key_at(bptree, parent, index), elem_size);
+    memcpy(_children_of(bptree, left) + left->count + 1, _children_of(bptree, right),
+      (right->count + 1) * sizeof(*children));
+
+    ++left->count;
+  }
+
+  memcpy(_key_at(bptree, left, left->count), _key_at(bptree, right, 0), right->count * elem_size);
+  left->count += right->count;
+
+  // unlink the right node from its level
+  left->next = right->next;
+  if (right->next != NULL)
+  {
+    right->next->prev = left;
+  }
+
+  free(right);
+
+  // remove the separator and the right child from the parent
+  memmove(_key_at(bptree, parent, index), _key_at(bptree, parent, index + 1),
+    (parent->count - index - 1) * elem_size);
+  memmove(children + index + 1, children + index + 2,
+    (parent->count - index - 1) * sizeof(*children));
+
+  --parent->count;
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_bptree_node_t* _new_bptree_node(struct kc_bptree_t* bptree, bool leaf)
+{
+  // the leaves don't need the room for the children
+  size_t size = leaf ? bptree->_children_offset :
+    bptree->_children_offset + (KC_BPTREE_ORDER + 2) * sizeof(struct kc_bptree_node_t*);
+
+  struct kc_bptree_node_t* new_node = malloc(size);
+
+  if (new_node == NULL)
+  {
+    return NULL;
+  }
+
+  new_node->next  = NULL;
+  new_node->prev  = NULL;
+  new_node->count = 0;
+  new_node->leaf  = leaf;
+
+  return new_node;
+}
+
+//---------------------------------------------------------------------------//
+
+void* _split_node(struct kc_bptree_t* bptree, struct kc_bptree_node_t* node,
+    struct kc_bptree_node_t* right)
+{
+  size_t elem_size = bptree->_elem_size;
+  size_t half      = node->count / 2;
+
+  void* separator = NULL;
+
+  if (node->leaf)
+  {
+    // the right half of the items moves, its first item is copied up
+    right->count = node->count - half;
+    memcpy(_key_at(bptree, right, 0), _key_at(bptree, node, half), right->count * elem_size);
+
+    separator = _key_at(bptree, right, 0);
+  }
+  else
+  {
+    // the middle item moves up, the ones after it move to the right node
+    right->count = node->count - half - 1;
+    memcpy(_key_at(bptree, right, 0), _key_at(bptree, node, half + 1), right->count * elem_size);
+    memcpy(_children_of(bptree, right), _children_of(bptree, node) + half + 1,
+      (right->count + 1) * sizeof(struct kc_bptree_node_t*));
+
+    separator = _key_at(bptree, node, half);
+  }
+
+  node->count = half;
+
+  // link the new node right after the split one
+  right->next = node->next;
+  right->prev = node;
+
+  if (node->next != NULL)
+  {
+    node->next->prev = right;
+  }
+
+  node->next = right;
+
+  return separator;
+}
+
+//---------------------------------------------------------------------------//
+
+size_t _upper_index(struct kc_bptree_t* bptree, struct kc_bptree_node_t* node, void* data)
+{
+  // binary search for the first item that is greater than the data, which
+  // is also the child that holds the data inside an inner node
+  size_t low  = 0;
+  size_t high = node->count;
+
+  while (low < high)
+  {
+    size_t mid = low + (high - low) / 2;
+
+    if (bptree->compare(_key_at(bptree, node, mid), data) <= 0)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+
+  return low;
+}
+
+//---------------------------------------------------------------------------//
@@ -13,7 +13,9 @@
 
 //--- MARK: PUBLIC FUNCTION PROTOTYPES --------------------------------------//
 
+static int concat_lists          (struct kc_list_t* self, struct kc_list_t* other);
 static int erase_all_nodes       (struct kc_list_t* self);
+static int erase_cursor_node     (struct kc_list_t* self, struct kc_list_cursor_t* cursor);
 static int erase_first_node      (struct kc_list_t* self);
 static int erase_last_node       (struct kc_list_t* self);
 static int erase_node            (struct kc_list_t* self, int index);
@@ -21,18 +23,36 @@ static int erase_nodes_by_value  (struct kc_list_t* self, void* value, int (*com
 static int get_first_node        (struct kc_list_t* self, struct kc_node_t** front_node);
 static int get_last_node         (struct kc_list_t* self, struct kc_node_t** back_node);
 static int get_node              (struct kc_list_t* self, int index, struct kc_node_t** node);
+static int init_cursor           (struct kc_list_t* self, int index, struct kc_list_cursor_t* cursor);
+static int insert_after_cursor   (struct kc_list_t* self, struct kc_list_cursor_t* cursor, void* data, size_t size);
+static int insert_before_cursor  (struct kc_list_t* self, struct kc_list_cursor_t* cursor, void* data, size_t size);
 static int insert_new_head       (struct kc_list_t* self, void* data, size_t size);
 static int insert_new_node       (struct kc_list_t* self, int index, void* data, size_t size);
 static int insert_new_tail       (struct kc_list_t* self, void* data, size_t size);
 static int is_list_empty         (struct kc_list_t* self, bool* is_empty);
+static int move_cursor_next      (struct kc_list_t* self, struct kc_list_cursor_t* cursor);
+static int move_cursor_prev      (struct kc_list_t* self, struct kc_list_cursor_t* cursor);
 static int search_node           (struct kc_list_t* self, void* value, int (*compare)(const void* a, const void* b), bool* exists);
+static int sort_nodes            (struct kc_list_t* self, int (*compare)(const void* a, const void* b));
+static int splice_nodes          (struct kc_list_t* self, struct kc_list_cursor_t* cursor, struct kc_list_t* other, struct kc_list_cursor_t* first, struct kc_list_cursor_t* last);
+static int split_list            (struct kc_list_t* self, struct kc_list_cursor_t* cursor, struct kc_list_t* other);
 
 
 //--- MARK: PRIVATE FUNCTION PROTOTYPES -------------------------------------//
 
-static struct kc_node_t* _iterate_ll          (struct kc_list_t* list, int index);
-static struct kc_node_t* _iterate_forward_ll  (struct kc_node_t* head, int index);
-static struct kc_node_t* _iterate_reverse_ll  (struct kc_node_t* tail, int index);
+static struct kc_node_t*      _create_node   (struct kc_list_t* self, void* data, size_t size);
+static void                   _drop_levels   (struct kc_list_t* self);
+static int                    _join_pools    (struct kc_list_t* self, struct kc_list_t* other);
+static void                   _link_node     (struct kc_list_t* self, struct kc_node_t* node, size_t pos, struct kc_node_t** preds, size_t* pred_pos);
+static struct kc_node_t*      _locate        (struct kc_list_t* self, size_t limit, struct kc_node_t** preds, size_t* pred_pos);
+static struct kc_node_t*      _merge_runs    (struct kc_node_t* left, struct kc_node_t* right, int (*compare)(const void* a, const void* b));
+static void                   _move_nodes    (struct kc_list_t* self, struct kc_node_t* before, struct kc_list_t* other, struct kc_node_t* first, struct kc_node_t* last, size_t count);
+static struct kc_node_pool_t* _pool_of       (struct kc_list_t* self, size_t height);
+static void                   _refresh_index (struct kc_list_t* self);
+static void                   _release_node  (struct kc_list_t* self, struct kc_node_t* node);
+static void                   _reset_index   (struct kc_list_t* self);
+static void                   _shift_index   (struct kc_list_t* self, size_t pos, struct kc_node_t** preds, bool grow);
+static void                   _unlink_node   (struct kc_list_t* self, struct kc_node_t* node, size_t pos);
 
 //---------------------------------------------------------------------------//
 
@@ -61,25 +81,58 @@ struct kc_list_t* new_list()
     return NULL;
   }
 
+  // the nodes of the list are allocated in chunks, the pools of the taller
+  // nodes are only created once they are needed
+  for (size_t height = 1; height < KC_LIST_MAX_LEVEL; ++height)
+  {
+    new_list->_pools[height] = NULL;
+  }
+
+  new_list->_pools[0] = new_node_pool(sizeof(struct kc_list_node_t));
+
+  if (new_list->_pools[0] == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+
+    // free the list instances
+    destroy_logger(new_list->_logger);
+    free(new_list);
+
+    return NULL;
+  }
+
   // initialize the structure members fields
   new_list->_head   = NULL;
   new_list->_tail   = NULL;
+  new_list->_seed   = 0x9E3779B97F4A7C15ULL;
   new_list->length  = 0;
 
+  _reset_index(new_list);
+
   // assigns the public member methods
-  new_list->back       = get_last_node;
-  new_list->clear      = erase_all_nodes;
-  new_list->empty      = is_list_empty;
-  new_list->erase      = erase_node;
-  new_list->front      = get_first_node;
-  new_list->get        = get_node;
-  new_list->insert     = insert_new_node;
-  new_list->pop_back   = erase_last_node;
-  new_list->pop_front  = erase_first_node;
-  new_list->push_back  = insert_new_tail;
-  new_list->push_front = insert_new_head;
-  new_list->remove     = erase_nodes_by_value;
-  new_list->search     = search_node;
+  new_list->back          = get_last_node;
+  new_list->clear         = erase_all_nodes;
+  new_list->concat        = concat_lists;
+  new_list->cursor        = init_cursor;
+  new_list->cursor_next   = move_cursor_next;
+  new_list->cursor_prev   = move_cursor_prev;
+  new_list->empty         = is_list_empty;
+  new_list->erase         = erase_node;
+  new_list->erase_at      = erase_cursor_node;
+  new_list->front         = get_first_node;
+  new_list->get           = get_node;
+  new_list->insert        = insert_new_node;
+  new_list->insert_after  = insert_after_cursor;
+  new_list->insert_before = insert_before_cursor;
+  new_list->pop_back      = erase_last_node;
+  new_list->pop_front     = erase_first_node;
+  new_list->push_back     = insert_new_tail;
+  new_list->push_front    = insert_new_head;
+  new_list->remove        = erase_nodes_by_value;
+  new_list->search        = search_node;
+  new_list->sort          = sort_nodes;
+  new_list->splice        = splice_nodes;
+  new_list->split         = split_list;
 
   return new_list;
 }
@@ -98,11 +151,56 @@ void destroy_list(struct kc_list_t* list)
   destroy_logger(list->_logger);
 
   erase_all_nodes(list);
+
+  for (size_t height = 0; height < KC_LIST_MAX_LEVEL; ++height)
+  {
+    if (list->_pools[height] != NULL)
+    {
+      destroy_node_pool(list->_pools[height]);
+    }
+  }
+
   free(list);
 }
 
 //---------------------------------------------------------------------------//
 
+int concat_lists(struct kc_list_t* self, struct kc_list_t* other)
+{
+  // if the list references are NULL, do nothing
+  if (self == NULL || other == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // a list can't be moved into itself
+  if (self == other)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INVALID,
+        __FILE__, __LINE__, __func__);
+
+    return KC_INVALID;
+  }
+
+  if (other->length == 0)
+  {
+    return KC_SUCCESS;
+  }
+
+  int ret = _join_pools(self, other);
+  if (ret != KC_SUCCESS)
+  {
+    return ret;
+  }
+
+  _move_nodes(self, NULL, other, other->_head, other->_tail, other->length);
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
 int erase_all_nodes(struct kc_list_t* self)
 {
   // if the list reference is NULL, do nothing
@@ -112,20 +210,91 @@ int erase_all_nodes(struct kc_list_t* self)
     return KC_NULL_REFERENCE;
   }
 
-  // start iterating from the head
+  // free the data of every node, then release all the nodes at once,
+  // unless their pool is joined, since a joined pool may hold the nodes of
+  // other lists as well, so its nodes are released one by one
   struct kc_node_t* cursor = self->_head;
   while (cursor != NULL)
   {
     struct kc_node_t* next = cursor->next;
-    node_destructor(cursor);
+    struct kc_node_pool_t* pool =
+      self->_pools[((struct kc_list_node_t*)cursor)->height - 1];
+
+    if (pool->_parent != NULL || pool->_joined != NULL)
+    {
+      _release_node(self, cursor);
+    }
+    else
+    {
+      pooled_node_free_data(pool, cursor);
+    }
+
     cursor = next;
   }
 
-  // reset the head, tail and size
+  for (size_t height = 0; height < KC_LIST_MAX_LEVEL; ++height)
+  {
+    if (self->_pools[height] != NULL)
+    {
+      clear_node_pool(self->_pools[height]);
+    }
+  }
+
+  // reset the head, tail, size and the index levels
   self->_head = NULL;
   self->_tail = NULL;
   self->length = 0;
 
+  _reset_index(self);
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int erase_cursor_node(struct kc_list_t* self, struct kc_list_cursor_t* cursor)
+{
+  // if the list reference is NULL, do nothing
+  if (self == NULL || cursor == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // a cursor past the tail has no node to remove
+  if (cursor->node == NULL)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INDEX_OUT_OF_BOUNDS,
+        __FILE__, __LINE__, __func__);
+
+    return KC_INDEX_OUT_OF_BOUNDS;
+  }
+
+  // the cursor moves to the next node, which takes the same index
+  struct kc_node_t* node_to_remove = cursor->node;
+  cursor->node = node_to_remove->next;
+
+  // the ends keep the index up to date
+  if (node_to_remove == self->_head)
+  {
+    return erase_first_node(self);
+  }
+
+  if (node_to_remove == self->_tail)
+  {
+    return erase_last_node(self);
+  }
+
+  node_to_remove->prev->next = node_to_remove->next;
+  node_to_remove->next->prev = node_to_remove->prev;
+
+  // the index is rebuilt only when it is needed again
+  self->_stale = true;
+
+  _release_node(self, node_to_remove);
+
+  --self->length;
+
   return KC_SUCCESS;
 }
 
@@ -140,8 +309,27 @@ int erase_first_node(struct kc_list_t* self)
     return KC_NULL_REFERENCE;
   }
 
+  // there is nothing to remove from an empty list
+  if (self->length == 0)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_EMPTY_STRUCTURE,
+        __FILE__, __LINE__, __func__);
+
+    return KC_EMPTY_STRUCTURE;
+  }
+
   struct kc_node_t* old_head = self->_head;
 
+  // the head is the first node of all its levels, so it is taken out
+  // without searching, and the positions of the other nodes stay the same
+  if (!self->_stale)
+  {
+    _unlink_node(self, old_head, self->_base);
+    _drop_levels(self);
+  }
+
+  ++self->_base;
+
   // check if this is alos the last node
   if (old_head->next == NULL)
   {
@@ -154,7 +342,7 @@ int erase_first_node(struct kc_list_t* self)
     self->_head->prev = NULL;
   }
 
-  node_destructor(old_head);
+  _release_node(self, old_head);
   --self->length;
 
   return KC_SUCCESS;
@@ -171,8 +359,24 @@ int erase_last_node(struct kc_list_t* self)
     return KC_NULL_REFERENCE;
   }
 
+  // there is nothing to remove from an empty list
+  if (self->length == 0)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_EMPTY_STRUCTURE,
+        __FILE__, __LINE__, __func__);
+
+    return KC_EMPTY_STRUCTURE;
+  }
+
   struct kc_node_t* old_tail = self->_tail;
 
+  // the tail is the last node of all its levels
+  if (!self->_stale)
+  {
+    _unlink_node(self, old_tail, self->_base + self->length - 1);
+    _drop_levels(self);
+  }
+
   // check if this is alos the last node
   if (old_tail->prev == NULL)
   {
@@ -185,7 +389,7 @@ int erase_last_node(struct kc_list_t* self)
     self->_tail->next = NULL;
   }
 
-  node_destructor(old_tail);
+  _release_node(self, old_tail);
   --self->length;
 
   return KC_SUCCESS;
@@ -223,15 +427,26 @@ int erase_node(struct kc_list_t* self, int index)
     return erase_last_node(self);
   }
 
+  struct kc_node_t* preds[KC_LIST_MAX_LEVEL - 1] = { NULL };
+  size_t pred_pos[KC_LIST_MAX_LEVEL - 1] = { 0 };
+  _refresh_index(self);
+
+  size_t pos = self->_base + index;
+
   // find the node in the list before the one that is going to be removed
-  struct kc_node_t* current = _iterate_ll(self, index - 1);
+  struct kc_node_t* current = _locate(self, pos, preds, pred_pos);
 
   // use the node returned to define the node to be removed
   struct kc_node_t *node_to_remove = current->next;
   current->next = node_to_remove->next;
   current->next->prev = current;
 
-  node_destructor(node_to_remove);
+  // the nodes after the removed one move one position to the left
+  _unlink_node(self, node_to_remove, pos);
+  _shift_index(self, pos, preds, false);
+  _drop_levels(self);
+
+  _release_node(self, node_to_remove);
 
   --self->length;
 
@@ -251,53 +466,29 @@ int erase_nodes_by_value(struct kc_list_t* self, void* value, int (*compare)(con
 
   // start from the head
   struct kc_node_t* cursor = self->_head;
-  size_t index = 0;
+  int index = 0;
 
   // search the node by value
   while (cursor != NULL)
   {
+    struct kc_node_t* next = cursor->next;
+
     if (compare(cursor->data, value) == 0)
     {
-      // erase the head
-      if (index == 0)
+      // the nodes after it take its index
+      int ret = erase_node(self, index);
+      if (ret != KC_SUCCESS)
       {
-        cursor = cursor->next;
-
-        int ret = erase_first_node(self);
-        if (ret != KC_SUCCESS)
-        {
-          return ret;
-        }
-
-        continue;
-      }
-
-      // erase the tail
-      if (index == self->length - 1)
-      {
-        int ret = erase_last_node(self);
-        if (ret != KC_SUCCESS)
-        {
-          return ret;
-        }
-
-        break;
+        return ret;
       }
-
-      // use the node cursor to define the node to be removed
-      struct kc_node_t *node_to_remove = cursor;
-      cursor->prev->next = cursor->next;
-      cursor->next->prev = cursor->prev;
-      cursor = cursor->next;
-
-      node_destructor(node_to_remove);
-      --self->length;
-      continue;
+    }
+    else
+    {
+      ++index;
     }
 
     // continue searching
-    cursor = cursor->next;
-    ++index;
+    cursor = next;
   }
 
   return KC_SUCCESS;
@@ -364,7 +555,141 @@ int get_node(struct kc_list_t* self, int index, struct kc_node_t** node)
     return KC_INDEX_OUT_OF_BOUNDS;
   }
 
-  (*node) = _iterate_ll(self, index);
+  struct kc_node_t* preds[KC_LIST_MAX_LEVEL - 1] = { NULL };
+  size_t pred_pos[KC_LIST_MAX_LEVEL - 1] = { 0 };
+
+  _refresh_index(self);
+
+  // the node at the index is the last one before the next position
+  (*node) = _locate(self, self->_base + index + 1, preds, pred_pos);
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int init_cursor(struct kc_list_t* self, int index, struct kc_list_cursor_t* cursor)
+{
+  // if the list reference is NULL, do nothing
+  if (self == NULL || cursor == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // the cursor can also be placed right after the tail
+  if (index < 0 || index > self->length)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INDEX_OUT_OF_BOUNDS,
+        __FILE__, __LINE__, __func__);
+
+    return KC_INDEX_OUT_OF_BOUNDS;
+  }
+
+  cursor->node  = NULL;
+  cursor->index = (size_t)index;
+
+  if (index < self->length)
+  {
+    return get_node(self, index, &cursor->node);
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int insert_after_cursor(struct kc_list_t* self, struct kc_list_cursor_t* cursor,
+    void* data, size_t size)
+{
+  // if the list reference is NULL, do nothing
+  if (self == NULL || cursor == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // a cursor past the tail has no node to insert after
+  if (cursor->node == NULL)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INDEX_OUT_OF_BOUNDS,
+        __FILE__, __LINE__, __func__);
+
+    return KC_INDEX_OUT_OF_BOUNDS;
+  }
+
+  // the new tail keeps the index up to date
+  if (cursor->node == self->_tail)
+  {
+    return insert_new_node(self, (int)self->length, data, size);
+  }
+
+  // create a new node to be inserted
+  struct kc_node_t* new_node = _create_node(self, data, size);
+
+  // if the node is NULL, don't make the insertion
+  if (new_node == NULL)
+  {
+    return KC_INVALID; /* an error has already been displayed */
+  }
+
+  new_node->prev = cursor->node;
+  new_node->next = cursor->node->next;
+  cursor->node->next->prev = new_node;
+  cursor->node->next = new_node;
+
+  // the index is rebuilt only when it is needed again
+  self->_stale = true;
+
+  ++self->length;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int insert_before_cursor(struct kc_list_t* self, struct kc_list_cursor_t* cursor,
+    void* data, size_t size)
+{
+  // if the list reference is NULL, do nothing
+  if (self == NULL || cursor == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // the new head or tail keeps the index up to date
+  if (cursor->index == 0 || cursor->node == NULL)
+  {
+    int ret = insert_new_node(self, (int)cursor->index, data, size);
+
+    if (ret == KC_SUCCESS)
+    {
+      ++cursor->index;
+    }
+
+    return ret;
+  }
+
+  // create a new node to be inserted
+  struct kc_node_t* new_node = _create_node(self, data, size);
+
+  // if the node is NULL, don't make the insertion
+  if (new_node == NULL)
+  {
+    return KC_INVALID; /* an error has already been displayed */
+  }
+
+  new_node->prev = cursor->node->prev;
+  new_node->next = cursor->node;
+  cursor->node->prev->next = new_node;
+  cursor->node->prev = new_node;
+
+  // the index is rebuilt only when it is needed again
+  self->_stale = true;
+
+  ++self->length;
+  ++cursor->index;
 
   return KC_SUCCESS;
 }
@@ -405,7 +730,7 @@ int insert_new_node(struct kc_list_t* self, int index, void* data, size_t size)
   }
 
   // create a new node to be inserted
-  struct kc_node_t* new_node = node_constructor(data, size);
+  struct kc_node_t* new_node = _create_node(self, data, size);
 
   // if the node is NULL, don't make the insertion
   if (new_node == NULL)
@@ -413,45 +738,70 @@ int insert_new_node(struct kc_list_t* self, int index, void* data, size_t size)
     return KC_INVALID; /* an error has already been displayed */
   }
 
+  struct kc_node_t* preds[KC_LIST_MAX_LEVEL - 1] = { NULL };
+  size_t pred_pos[KC_LIST_MAX_LEVEL - 1] = { 0 };
+  size_t pos = 0;
+
   // check if this node will be the new head
   if (index == 0)
   {
+    // the new head takes the position before the old one, so the positions
+    // of the other nodes stay the same
+    pos = --self->_base;
+
     new_node->next = self->_head;
-    self->_head = new_node;
 
     // if length is less than 1 then head is also tail
     if (self->length == 0)
     {
       self->_tail = new_node;
     }
+    else
+    {
+      self->_head->prev = new_node;
+    }
 
-    ++self->length;
-
-    return KC_SUCCESS;
+    self->_head = new_node;
   }
+  // check if this node will be the new tail
+  else if (index == self->length)
+  {
+    pos = self->_base + self->length;
 
-  // find the item in the list immediately before the desired index
-  struct kc_node_t* cursor = _iterate_ll(self, index - 1);
+    // the new tail comes after the last node of every level
+    for (size_t level = 0; level < self->_levels; ++level)
+    {
+      preds[level]    = self->_lanes[level].last;
+      pred_pos[level] = self->_lanes[level].last_pos;
+    }
 
-  if (cursor == NULL)
-  {
-    return KC_NULL_REFERENCE; /* an error has already been displayed */
+    new_node->prev = self->_tail;
+    self->_tail->next = new_node;
+    self->_tail = new_node;
   }
+  else
+  {
+    _refresh_index(self);
 
-  new_node->next = cursor->next;
-  new_node->prev = cursor;
-  cursor->next = new_node;
+    pos = self->_base + index;
 
-  // the "prev" of the third node must point to the new node
-  if (new_node->next)
-  {
+    // find the item in the list immediately before the desired index
+    struct kc_node_t* cursor = _locate(self, pos, preds, pred_pos);
+
+    // the nodes from the index onwards move one position to the right
+    _shift_index(self, pos, preds, true);
+
+    new_node->next = cursor->next;
+    new_node->prev = cursor;
+    cursor->next = new_node;
+
+    // the "prev" of the third node must point to the new node
     new_node->next->prev = new_node;
   }
 
-  // check if this node will be the new tail
-  if (index == self->length)
+  if (!self->_stale)
   {
-    self->_tail = new_node;
+    _link_node(self, new_node, pos, preds, pred_pos);
   }
 
   // increment the list length
@@ -499,30 +849,83 @@ int is_list_empty(struct kc_list_t* self, bool* is_empty)
 
 //---------------------------------------------------------------------------//
 
-int search_node(struct kc_list_t* self, void* value,
-    int (*compare)(const void* a, const void* b), bool* exists)
+int move_cursor_next(struct kc_list_t* self, struct kc_list_cursor_t* cursor)
 {
   // if the list reference is NULL, do nothing
-  if (self == NULL)
+  if (self == NULL || cursor == NULL)
   {
     log_error(KC_NULL_REFERENCE_LOG);
     return KC_NULL_REFERENCE;
   }
 
-  // create a new node instance
-  struct kc_node_t* node = self->_head;
-
-  // search the node by value
-  while (node != NULL && compare(node->data, value) != 0)
+  // the cursor can't go further than right after the tail
+  if (cursor->node == NULL)
   {
-    node = node->next;
-  }
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INDEX_OUT_OF_BOUNDS,
+        __FILE__, __LINE__, __func__);
 
-  if (node != NULL)
-  {
-    (*exists) = true;
+    return KC_INDEX_OUT_OF_BOUNDS;
   }
-  else
+
+  cursor->node = cursor->node->next;
+  ++cursor->index;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int move_cursor_prev(struct kc_list_t* self, struct kc_list_cursor_t* cursor)
+{
+  // if the list reference is NULL, do nothing
+  if (self == NULL || cursor == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // the cursor can't go before the head
+  if (cursor->index == 0)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INDEX_OUT_OF_BOUNDS,
+        __FILE__, __LINE__, __func__);
+
+    return KC_INDEX_OUT_OF_BOUNDS;
+  }
+
+  // from right after the tail, the cursor goes back to the tail
+  cursor->node = cursor->node != NULL ? cursor->node->prev : self->_tail;
+  --cursor->index;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int search_node(struct kc_list_t* self, void* value,
+    int (*compare)(const void* a, const void* b), bool* exists)
+{
+  // if the list reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // create a new node instance
+  struct kc_node_t* node = self->_head;
+
+  // search the node by value
+  while (node != NULL && compare(node->data, value) != 0)
+  {
+    node = node->next;
+  }
+
+  if (node != NULL)
+  {
+    (*exists) = true;
+  }
+  else
   {
     (*exists) = false;
   }
@@ -532,56 +935,620 @@ int search_node(struct kc_list_t* self, void* value,
 
 //---------------------------------------------------------------------------//
 
-struct kc_node_t* _iterate_ll(struct kc_list_t* self, int index)
+int sort_nodes(struct kc_list_t* self, int (*compare)(const void* a, const void* b))
 {
   // if the list reference is NULL, do nothing
-  if (self == NULL || self->_head == NULL || self->_tail == NULL)
+  if (self == NULL || compare == NULL)
   {
     log_error(KC_NULL_REFERENCE_LOG);
-    return NULL;
+    return KC_NULL_REFERENCE;
   }
 
-  // confirm the user has specified a valid index
-  if (index < 0 || index >= self->length)
+  if (self->length < 2)
+  {
+    return KC_SUCCESS;
+  }
+
+  // the bin "k" holds a sorted run of 2^k nodes, or nothing, so every node
+  // taken from the list is merged with the runs before it, like a carry
+  // propagating through the bits of a counter
+  struct kc_node_t* bins[sizeof(size_t) * 8] = { NULL };
+  size_t used = 0;
+
+  struct kc_node_t* cursor = self->_head;
+  while (cursor != NULL)
+  {
+    struct kc_node_t* run = cursor;
+    cursor = cursor->next;
+    run->next = NULL;
+
+    // the runs in the bins hold the earlier nodes, so they go first
+    size_t bin = 0;
+    for (; bin < used && bins[bin] != NULL; ++bin)
+    {
+      run = _merge_runs(bins[bin], run, compare);
+      bins[bin] = NULL;
+    }
+
+    if (bin == used)
+    {
+      ++used;
+    }
+
+    bins[bin] = run;
+  }
+
+  // merge what is left in the bins, the bigger runs hold the earlier nodes
+  struct kc_node_t* sorted = NULL;
+  for (size_t bin = 0; bin < used; ++bin)
+  {
+    if (bins[bin] != NULL)
+    {
+      sorted = sorted == NULL ? bins[bin] : _merge_runs(bins[bin], sorted, compare);
+    }
+  }
+
+  // only the "next" links were kept while merging, so restore the rest
+  self->_head = sorted;
+  self->_head->prev = NULL;
+
+  for (cursor = self->_head; cursor->next != NULL; cursor = cursor->next)
+  {
+    cursor->next->prev = cursor;
+  }
+
+  self->_tail = cursor;
+
+  // the index is rebuilt only when it is needed again
+  self->_stale = true;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int splice_nodes(struct kc_list_t* self, struct kc_list_cursor_t* cursor,
+    struct kc_list_t* other, struct kc_list_cursor_t* first,
+    struct kc_list_cursor_t* last)
+{
+  // if the list references are NULL, do nothing
+  if (self == NULL || cursor == NULL || other == NULL || first == NULL || last == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // the nodes can't be moved inside the same list
+  if (self == other)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INVALID,
+        __FILE__, __LINE__, __func__);
+
+    return KC_INVALID;
+  }
+
+  // the range must go forward
+  if (first->index > last->index)
   {
-    // log the warning to the console
     self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INDEX_OUT_OF_BOUNDS,
         __FILE__, __LINE__, __func__);
 
-    return NULL;
+    return KC_INDEX_OUT_OF_BOUNDS;
+  }
+
+  size_t count = last->index - first->index;
+
+  if (count == 0)
+  {
+    return KC_SUCCESS;
+  }
+
+  int ret = _join_pools(self, other);
+  if (ret != KC_SUCCESS)
+  {
+    return ret;
+  }
+
+  struct kc_node_t* last_node = last->node != NULL ? last->node->prev : other->_tail;
+
+  _move_nodes(self, cursor->node, other, first->node, last_node, count);
+
+  // the cursor is pushed after the moved nodes, and both cursors of the
+  // other list now point to the node that followed the range
+  cursor->index += count;
+
+  first->node = last->node;
+  last->index = first->index;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int split_list(struct kc_list_t* self, struct kc_list_cursor_t* cursor,
+    struct kc_list_t* other)
+{
+  // if the list references are NULL, do nothing
+  if (self == NULL || cursor == NULL || other == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // a list can't be moved into itself
+  if (self == other)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INVALID,
+        __FILE__, __LINE__, __func__);
+
+    return KC_INVALID;
+  }
+
+  // there is nothing to move from right after the tail
+  if (cursor->node == NULL)
+  {
+    return KC_SUCCESS;
   }
 
-  // check if the index is over the half of the list length, if the index is
-  // smaller, then start from the head, otherwise start from the tail
-  struct kc_node_t* node = index <= self->length / 2 ?
-      _iterate_forward_ll(self->_head, index) :
-      _iterate_reverse_ll(self->_tail, (int)(self->length - 1) - index);
+  int ret = _join_pools(other, self);
+  if (ret != KC_SUCCESS)
+  {
+    return ret;
+  }
+
+  _move_nodes(other, NULL, self, cursor->node, self->_tail, self->length - cursor->index);
+
+  // the cursor is left right after the new tail
+  cursor->node = NULL;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_node_t* _create_node(struct kc_list_t* self, void* data, size_t size)
+{
+  // draw the height of the node, every extra level is kept with a
+  // probability of 1/4, using two bits of a xorshift generator each
+  self->_seed ^= self->_seed << 13;
+  self->_seed ^= self->_seed >> 7;
+  self->_seed ^= self->_seed << 17;
+
+  uint64_t bits = self->_seed;
+  size_t height = 1;
+
+  while (height < KC_LIST_MAX_LEVEL && (bits & 3) == 0)
+  {
+    ++height;
+    bits >>= 2;
+  }
+
+  // without a pool for its height, the node only lives on the list itself,
+  // which makes the index a bit slower but still correct
+  struct kc_node_pool_t* pool = _pool_of(self, height);
+
+  if (pool == NULL)
+  {
+    height = 1;
+    pool = self->_pools[0];
+  }
+
+  // the links are stored right after the node, in the same slot
+  struct kc_node_t* node = pooled_node_constructor(pool, data, size);
+
+  if (node == NULL)
+  {
+    return NULL; /* an error has already been displayed */
+  }
+
+  ((struct kc_list_node_t*)node)->height = height;
 
   return node;
 }
 
 //---------------------------------------------------------------------------//
 
-struct kc_node_t* _iterate_forward_ll(struct kc_node_t* head, int index)
+void _drop_levels(struct kc_list_t* self)
 {
-  struct kc_node_t* cursor = head;
-  for (int i = 0; i < index; ++i)
+  // a level with no nodes left is no longer searched
+  while (self->_levels > 0 && self->_lanes[self->_levels - 1].first == NULL)
+  {
+    --self->_levels;
+  }
+}
+
+//---------------------------------------------------------------------------//
+
+int _join_pools(struct kc_list_t* self, struct kc_list_t* other)
+{
+  // the nodes keep their height when moved, so the pools of every height
+  // used by any of the lists are joined
+  for (size_t height = 1; height <= KC_LIST_MAX_LEVEL; ++height)
+  {
+    if (self->_pools[height - 1] == NULL && other->_pools[height - 1] == NULL)
+    {
+      continue;
+    }
+
+    struct kc_node_pool_t* pool = _pool_of(self, height);
+    struct kc_node_pool_t* other_pool = _pool_of(other, height);
+
+    if (pool == NULL || other_pool == NULL)
+    {
+      return KC_OUT_OF_MEMORY; /* an error has already been displayed */
+    }
+
+    int ret = join_node_pools(pool, other_pool);
+    if (ret != KC_SUCCESS)
+    {
+      return ret;
+    }
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+void _link_node(struct kc_list_t* self, struct kc_node_t* node, size_t pos,
+    struct kc_node_t** preds, size_t* pred_pos)
+{
+  struct kc_list_node_t* item = (struct kc_list_node_t*)node;
+
+  for (size_t level = 0; level + 1 < item->height; ++level)
+  {
+    struct kc_list_lane_t* lane = &self->_lanes[level];
+    struct kc_list_link_t* link = &item->links[level];
+    struct kc_node_t* pred = preds[level];
+    struct kc_node_t* succ = NULL;
+    size_t succ_pos = 0;
+
+    // the node goes right after the last node before its position, or
+    // becomes the first node of the level
+    if (pred != NULL)
+    {
+      struct kc_list_link_t* pred_link = &((struct kc_list_node_t*)pred)->links[level];
+
+      succ = pred_link->next;
+      succ_pos = pred_pos[level] + pred_link->width;
+
+      pred_link->next  = node;
+      pred_link->width = pos - pred_pos[level];
+    }
+    else
+    {
+      succ = lane->first;
+      succ_pos = lane->first_pos;
+
+      lane->first = node;
+      lane->first_pos = pos;
+    }
+
+    link->prev = pred;
+    link->next = succ;
+    link->width = 0;
+
+    if (succ != NULL)
+    {
+      ((struct kc_list_node_t*)succ)->links[level].prev = node;
+      link->width = succ_pos - pos;
+    }
+    else
+    {
+      lane->last = node;
+      lane->last_pos = pos;
+    }
+  }
+
+  if (item->height - 1 > self->_levels)
+  {
+    self->_levels = item->height - 1;
+  }
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_node_t* _locate(struct kc_list_t* self, size_t limit,
+    struct kc_node_t** preds, size_t* pred_pos)
+{
+  struct kc_node_t* cursor = NULL;
+  size_t cursor_pos = 0;
+
+  // go down the levels, moving forward on each one while the next node is
+  // still before the limit, and remember where every level was left
+  for (size_t level = self->_levels; level-- > 0; )
+  {
+    struct kc_list_lane_t* lane = &self->_lanes[level];
+
+    if (cursor == NULL && lane->first != NULL && lane->first_pos < limit)
+    {
+      cursor = lane->first;
+      cursor_pos = lane->first_pos;
+    }
+
+    if (cursor != NULL)
+    {
+      struct kc_list_link_t* link = &((struct kc_list_node_t*)cursor)->links[level];
+
+      while (link->next != NULL && cursor_pos + link->width < limit)
+      {
+        cursor_pos += link->width;
+        cursor = link->next;
+        link = &((struct kc_list_node_t*)cursor)->links[level];
+      }
+    }
+
+    preds[level]    = cursor;
+    pred_pos[level] = cursor_pos;
+  }
+
+  // finish the search on the list itself
+  if (cursor == NULL)
+  {
+    if (self->_head == NULL || self->_base >= limit)
+    {
+      return NULL;
+    }
+
+    cursor = self->_head;
+    cursor_pos = self->_base;
+  }
+
+  while (cursor->next != NULL && cursor_pos + 1 < limit)
   {
     cursor = cursor->next;
+    ++cursor_pos;
   }
+
   return cursor;
 }
 
 //---------------------------------------------------------------------------//
 
-struct kc_node_t* _iterate_reverse_ll(struct kc_node_t* tail, int index)
+struct kc_node_t* _merge_runs(struct kc_node_t* left, struct kc_node_t* right,
+    int (*compare)(const void* a, const void* b))
 {
-  struct kc_node_t* cursor = tail;
-  for (int i = 0; i < index; ++i)
+  struct kc_node_t head = { NULL, NULL, NULL };
+  struct kc_node_t* tail = &head;
+
+  // on equal nodes, the left one is taken first to keep the sort stable
+  while (left != NULL && right != NULL)
   {
-    cursor = cursor->prev;
+    if (compare(right->data, left->data) < 0)
+    {
+      tail->next = right;
+      right = right->next;
+    }
+    else
+    {
+      tail->next = left;
+      left = left->next;
+    }
+
+    tail = tail->next;
+  }
+
+  tail->next = left != NULL ? left : right;
+
+  return head.next;
+}
+
+//---------------------------------------------------------------------------//
+
+void _move_nodes(struct kc_list_t* self, struct kc_node_t* before,
+    struct kc_list_t* other, struct kc_node_t* first, struct kc_node_t* last,
+    size_t count)
+{
+  // take the nodes out of the other list
+  if (first->prev != NULL)
+  {
+    first->prev->next = last->next;
+  }
+  else
+  {
+    other->_head = last->next;
+  }
+
+  if (last->next != NULL)
+  {
+    last->next->prev = first->prev;
+  }
+  else
+  {
+    other->_tail = first->prev;
+  }
+
+  // link them before the given node, or after the tail
+  struct kc_node_t* after = before != NULL ? before->prev : self->_tail;
+
+  first->prev = after;
+  last->next = before;
+
+  if (after != NULL)
+  {
+    after->next = first;
+  }
+  else
+  {
+    self->_head = first;
+  }
+
+  if (before != NULL)
+  {
+    before->prev = last;
+  }
+  else
+  {
+    self->_tail = last;
+  }
+
+  self->length  += count;
+  other->length -= count;
+
+  // the indexes of both lists are rebuilt only when they are needed again
+  self->_stale  = true;
+  other->_stale = true;
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_node_pool_t* _pool_of(struct kc_list_t* self, size_t height)
+{
+  // every slot of the pool has room for the links of a node this tall
+  if (self->_pools[height - 1] == NULL)
+  {
+    self->_pools[height - 1] = new_node_pool(sizeof(struct kc_list_node_t) +
+        (height - 1) * sizeof(struct kc_list_link_t));
+  }
+
+  return self->_pools[height - 1];
+}
+
+//---------------------------------------------------------------------------//
+
+void _refresh_index(struct kc_list_t* self)
+{
+  if (!self->_stale)
+  {
+    return;
+  }
+
+  struct kc_node_t* preds[KC_LIST_MAX_LEVEL - 1] = { NULL };
+  size_t pred_pos[KC_LIST_MAX_LEVEL - 1] = { 0 };
+
+  _reset_index(self);
+
+  // every node keeps its height, so it is linked again after the last
+  // node of each of its levels, in a single pass over the list
+  size_t pos = self->_base;
+  for (struct kc_node_t* node = self->_head; node != NULL; node = node->next)
+  {
+    struct kc_list_node_t* item = (struct kc_list_node_t*)node;
+
+    for (size_t level = 0; level + 1 < item->height; ++level)
+    {
+      preds[level]    = self->_lanes[level].last;
+      pred_pos[level] = self->_lanes[level].last_pos;
+    }
+
+    _link_node(self, node, pos++, preds, pred_pos);
+  }
+}
+
+//---------------------------------------------------------------------------//
+
+void _release_node(struct kc_list_t* self, struct kc_node_t* node)
+{
+  size_t height = ((struct kc_list_node_t*)node)->height;
+
+  pooled_node_destructor(self->_pools[height - 1], node);
+}
+
+//---------------------------------------------------------------------------//
+
+void _reset_index(struct kc_list_t* self)
+{
+  for (size_t level = 0; level < KC_LIST_MAX_LEVEL - 1; ++level)
+  {
+    self->_lanes[level].first     = NULL;
+    self->_lanes[level].last      = NULL;
+    self->_lanes[level].first_pos = 0;
+    self->_lanes[level].last_pos  = 0;
+  }
+
+  // the positions start in the middle of the range, so the list can grow
+  // at the front without moving the positions of the other nodes
+  self->_levels = 0;
+  self->_base   = SIZE_MAX / 2;
+  self->_stale  = false;
+}
+
+//---------------------------------------------------------------------------//
+
+void _shift_index(struct kc_list_t* self, size_t pos,
+    struct kc_node_t** preds, bool grow)
+{
+  for (size_t level = 0; level < self->_levels; ++level)
+  {
+    struct kc_list_lane_t* lane = &self->_lanes[level];
+
+    // the link that goes over the position gets one node longer or shorter
+    if (preds[level] != NULL)
+    {
+      struct kc_list_link_t* link = &((struct kc_list_node_t*)preds[level])->links[level];
+
+      if (link->next != NULL)
+      {
+        link->width = grow ? link->width + 1 : link->width - 1;
+      }
+    }
+
+    if (lane->first == NULL)
+    {
+      continue;
+    }
+
+    // the ends of the level move along with the nodes after the position
+    if (grow ? lane->first_pos >= pos : lane->first_pos > pos)
+    {
+      lane->first_pos = grow ? lane->first_pos + 1 : lane->first_pos - 1;
+    }
+
+    if (grow ? lane->last_pos >= pos : lane->last_pos > pos)
+    {
+      lane->last_pos = grow ? lane->last_pos + 1 : lane->last_pos - 1;
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+
+void _unlink_node(struct kc_list_t* self, struct kc_node_t* node, size_t pos)
+{
+  struct kc_list_node_t* item = (struct kc_list_node_t*)node;
+
+  for (size_t level = 0; level + 1 < item->height; ++level)
+  {
+    struct kc_list_lane_t* lane = &self->_lanes[level];
+    struct kc_list_link_t* link = &item->links[level];
+    struct kc_node_t* pred = link->prev;
+    struct kc_node_t* succ = link->next;
+
+    if (succ != NULL)
+    {
+      ((struct kc_list_node_t*)succ)->links[level].prev = pred;
+    }
+
+    // the previous node now skips the removed one as well, otherwise
+    // the next node becomes the first of the level
+    if (pred != NULL)
+    {
+      struct kc_list_link_t* pred_link = &((struct kc_list_node_t*)pred)->links[level];
+
+      if (succ != NULL)
+      {
+        pred_link->width += link->width;
+      }
+      else
+      {
+        lane->last = pred;
+        lane->last_pos = pos - pred_link->width;
+        pred_link->width = 0;
+      }
+
+      pred_link->next = succ;
+    }
+    else
+    {
+      lane->first = succ;
+      lane->first_pos = pos + link->width;
+
+      if (succ == NULL)
+      {
+        lane->last = NULL;
+      }
+    }
   }
-  return cursor;
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,336 @@
+// This file is part of keepcoding_core
+// ==================================
+//
+// mpmc_queue.c
+//
+// Copyright (c) 2024 Daniel Tanase
+// SPDX-License-Identifier: MIT License
+
+#include "../../hdrs/datastructs/mpmc_queue.h"
+#include "../../hdrs/common.h"
+
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+//---------------------------------------------------------------------------//
+
+// how many times a waiting thread retries before giving up its time slice
+#define KC_MPMC_QUEUE_SPINS  64
+
+//--- MARK: PUBLIC FUNCTION PROTOTYPES --------------------------------------//
+
+static int get_length_mpmc_queue  (struct kc_mpmc_queue_t* self, size_t* length);
+static int pop_item_mpmc_queue    (struct kc_mpmc_queue_t* self, void* data);
+static int push_item_mpmc_queue   (struct kc_mpmc_queue_t* self, void* data);
+static int try_pop_mpmc_queue     (struct kc_mpmc_queue_t* self, void* data, bool* popped);
+static int try_push_mpmc_queue    (struct kc_mpmc_queue_t* self, void* data, bool* pushed);
+
+//--- MARK: PRIVATE FUNCTION PROTOTYPES -------------------------------------//
+
+static atomic_size_t* _cell_sequence  (struct kc_mpmc_queue_t* queue, size_t position);
+static void           _wait           (unsigned* spins);
+
+//---------------------------------------------------------------------------//
+
+struct kc_mpmc_queue_t* new_mpmc_queue(size_t capacity, size_t elem_size)
+{
+  // confirm the capacity and the size of the items are at least one
+  if (capacity < 1 || elem_size < 1)
+  {
+    log_error(KC_UNDERFLOW_LOG);
+    return NULL;
+  }
+
+  // create a MPMC Queue instance to be returned, aligned to the cache line
+  size_t size = (sizeof(struct kc_mpmc_queue_t) + KC_CACHE_LINE_SIZE - 1) /
+      KC_CACHE_LINE_SIZE * KC_CACHE_LINE_SIZE;
+
+  struct kc_mpmc_queue_t* new_queue = aligned_alloc(KC_CACHE_LINE_SIZE, size);
+
+  // confirm that there is memory to allocate
+  if (new_queue == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return NULL;
+  }
+
+  new_queue->_logger = new_logger(KC_MPMC_QUEUE_LOG_PATH);
+
+  if (new_queue->_logger == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+
+    // free the queue instance
+    free(new_queue);
+
+    return NULL;
+  }
+
+  // round the capacity up to a power of two, so the positions wrap around
+  // the buffer with a mask and the counters can overflow safely; a single
+  // cell would expect the same sequence number after a push as before it,
+  // so the buffer has at least two cells
+  size_t new_capacity = 2;
+  while (new_capacity < capacity)
+  {
+    new_capacity *= 2;
+  }
+
+  // every cell holds its sequence number followed by the item
+  size_t cell_size = sizeof(atomic_size_t) + elem_size;
+  cell_size = (cell_size + sizeof(atomic_size_t) - 1) /
+      sizeof(atomic_size_t) * sizeof(atomic_size_t);
+
+  new_queue->_cells = malloc(new_capacity * cell_size);
+
+  // confirm that there is memory to allocate
+  if (new_queue->_cells == NULL)
+  {
+    log_error(KC_OUT_OF_MEMORY_LOG);
+
+    // free the queue instances
+    destroy_logger(new_queue->_logger);
+    free(new_queue);
+
+    return NULL;
+  }
+
+  // initialize the structure members fields
+  new_queue->_capacity  = new_capacity;
+  new_queue->_cell_size = cell_size;
+  new_queue->_elem_size = elem_size;
+
+  atomic_init(&new_queue->_head, 0);
+  atomic_init(&new_queue->_tail, 0);
+
+  // each cell is ready to be written at the position equal to its index
+  for (size_t i = 0; i < new_capacity; ++i)
+  {
+    atomic_init(_cell_sequence(new_queue, i), i);
+  }
+
+  // assigns the public member methods
+  new_queue->length   = get_length_mpmc_queue;
+  new_queue->pop      = pop_item_mpmc_queue;
+  new_queue->push     = push_item_mpmc_queue;
+  new_queue->try_pop  = try_pop_mpmc_queue;
+  new_queue->try_push = try_push_mpmc_queue;
+
+  return new_queue;
+}
+
+//---------------------------------------------------------------------------//
+
+void destroy_mpmc_queue(struct kc_mpmc_queue_t* queue)
+{
+  // if the queue reference is NULL, do nothing
+  if (queue == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return;
+  }
+
+  destroy_logger(queue->_logger);
+
+  free(queue->_cells);
+  free(queue);
+}
+
+//---------------------------------------------------------------------------//
+
+int get_length_mpmc_queue(struct kc_mpmc_queue_t* self, size_t* length)
+{
+  // if the queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // the other threads might move in the meantime, so this is only a snapshot
+  size_t head = atomic_load_explicit(&self->_head, memory_order_acquire);
+  size_t tail = atomic_load_explicit(&self->_tail, memory_order_acquire);
+
+  (*length) = tail > head ? tail - head : 0;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int pop_item_mpmc_queue(struct kc_mpmc_queue_t* self, void* data)
+{
+  // if the queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  bool popped = false;
+  unsigned spins = 0;
+
+  // wait until there is an item to take
+  while (try_pop_mpmc_queue(self, data, &popped) == KC_SUCCESS && popped == false)
+  {
+    _wait(&spins);
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int push_item_mpmc_queue(struct kc_mpmc_queue_t* self, void* data)
+{
+  // if the queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  bool pushed = false;
+  unsigned spins = 0;
+
+  // wait until there is room for the item
+  while (try_push_mpmc_queue(self, data, &pushed) == KC_SUCCESS && pushed == false)
+  {
+    _wait(&spins);
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int try_pop_mpmc_queue(struct kc_mpmc_queue_t* self, void* data, bool* popped)
+{
+  // if the queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  size_t position = atomic_load_explicit(&self->_head, memory_order_relaxed);
+  atomic_size_t* sequence = NULL;
+
+  for (;;)
+  {
+    sequence = _cell_sequence(self, position);
+
+    // the cell is ready to be read once it was written at this position
+    size_t current = atomic_load_explicit(sequence, memory_order_acquire);
+    intptr_t diff = (intptr_t)current - (intptr_t)(position + 1);
+
+    if (diff == 0)
+    {
+      // claim the cell, or retry from the position another consumer left
+      if (atomic_compare_exchange_weak_explicit(&self->_head, &position,
+          position + 1, memory_order_relaxed, memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (diff < 0)
+    {
+      // the cell wasn't written yet, the queue is empty
+      (*popped) = false;
+      return KC_SUCCESS;
+    }
+    else
+    {
+      position = atomic_load_explicit(&self->_head, memory_order_relaxed);
+    }
+  }
+
+  memcpy(data, (unsigned char*)sequence + sizeof(atomic_size_t), self->_elem_size);
+
+  // the cell will be written again one lap later
+  atomic_store_explicit(sequence, position + self->_capacity, memory_order_release);
+
+  (*popped) = true;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int try_push_mpmc_queue(struct kc_mpmc_queue_t* self, void* data, bool* pushed)
+{
+  // if the queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  size_t position = atomic_load_explicit(&self->_tail, memory_order_relaxed);
+  atomic_size_t* sequence = NULL;
+
+  for (;;)
+  {
+    sequence = _cell_sequence(self, position);
+
+    // the cell is ready to be written once it was read one lap before
+    size_t current = atomic_load_explicit(sequence, memory_order_acquire);
+    intptr_t diff = (intptr_t)current - (intptr_t)position;
+
+    if (diff == 0)
+    {
+      // claim the cell, or retry from the position another producer left
+      if (atomic_compare_exchange_weak_explicit(&self->_tail, &position,
+          position + 1, memory_order_relaxed, memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (diff < 0)
+    {
+      // the cell wasn't read yet, the queue is full
+      (*pushed) = false;
+      return KC_SUCCESS;
+    }
+    else
+    {
+      position = atomic_load_explicit(&self->_tail, memory_order_relaxed);
+    }
+  }
+
+  memcpy((unsigned char*)sequence + sizeof(atomic_size_t), data, self->_elem_size);
+
+  // publish the item to the consumers
+  atomic_store_explicit(sequence, position + 1, memory_order_release);
+
+  (*pushed) = true;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+atomic_size_t* _cell_sequence(struct kc_mpmc_queue_t* queue, size_t position)
+{
+  size_t index = position & (queue->_capacity - 1);
+
+  return (atomic_size_t*)(queue->_cells + index * queue->_cell_size);
+}
+
+//---------------------------------------------------------------------------//
+
+void _wait(unsigned* spins)
+{
+  // spin for a while, then let the other threads run
+  if ((*spins) < KC_MPMC_QUEUE_SPINS)
+  {
+    ++(*spins);
+    return;
+  }
+
+  sched_yield();
+}
+
+//---------------------------------------------------------------------------//
@@ -12,6 +12,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+//--- MARK: PRIVATE FUNCTION PROTOTYPES -------------------------------------//
+
+static struct kc_node_pool_t* _find_pool_root    (struct kc_node_pool_t* pool);
+static void                   _free_pool_chunks  (struct kc_node_pool_t* pool);
+static size_t                 _node_header_size  (size_t node_size);
+
 //---------------------------------------------------------------------------//
 
 struct kc_node_t* node_constructor(void* data, size_t size)
@@ -21,9 +27,11 @@ struct kc_node_t* node_constructor(void* data, size_t size)
     return NULL;
   }
 
-  // create a Node instance to be returned
-  // and allocate space for the data
-  struct kc_node_t* new_node = malloc(sizeof(struct kc_node_t));
+  // create a Node instance to be returned, the data is stored
+  // right after the node, so both live in a single allocation
+  size_t header = _node_header_size(sizeof(struct kc_node_t));
+
+  struct kc_node_t* new_node = malloc(header + size);
 
   if (new_node == NULL)
   {
@@ -31,18 +39,225 @@ struct kc_node_t* node_constructor(void* data, size_t size)
     return NULL;
   }
 
-  new_node->data = malloc(size);
+  new_node->data = (unsigned char*)new_node + header;
+
+  // copy the block of memory
+  memcpy(new_node->data, data, size);
+
+  // initialize the pointers
+  new_node->next = NULL;
+  new_node->prev = NULL;
+
+  return new_node;
+}
+
+//---------------------------------------------------------------------------//
+
+void node_destructor(struct kc_node_t* node)
+{
+  // destroy node only if is not dereferenced
+  if (node == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return;
+  }
+
+  // the data is part of the node allocation
+  free(node);
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_node_pool_t* new_node_pool(size_t node_size)
+{
+  // the released nodes hold the free list, so they must fit a pointer
+  if (node_size < sizeof(struct kc_node_t))
+  {
+    log_error(KC_UNDERFLOW_LOG);
+    return NULL;
+  }
+
+  // create a Node Pool instance to be returned
+  struct kc_node_pool_t* new_pool = malloc(sizeof(struct kc_node_pool_t));
 
-  if (new_node->data == NULL)
+  if (new_pool == NULL)
   {
     log_error(KC_OUT_OF_MEMORY_LOG);
+    return NULL;
+  }
+
+  new_pool->_parent    = NULL;
+  new_pool->_joined    = NULL;
+  new_pool->_sibling   = NULL;
+  new_pool->_chunks    = NULL;
+  new_pool->_free      = NULL;
+  new_pool->_node_size = _node_header_size(node_size);
+  new_pool->_slot_size = new_pool->_node_size + KC_NODE_INLINE_SIZE;
+  new_pool->_refs      = 1;
+
+  return new_pool;
+}
+
+//---------------------------------------------------------------------------//
+
+void clear_node_pool(struct kc_node_pool_t* pool)
+{
+  if (pool == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return;
+  }
+
+  // the chunks of joined pools are freed only together
+  if (pool->_parent != NULL || pool->_joined != NULL)
+  {
+    return;
+  }
+
+  _free_pool_chunks(pool);
+}
+
+//---------------------------------------------------------------------------//
+
+void destroy_node_pool(struct kc_node_pool_t* pool)
+{
+  // destroy pool only if is not dereferenced
+  if (pool == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return;
+  }
+
+  // the joined pools are freed when the last of them is destroyed
+  struct kc_node_pool_t* root = _find_pool_root(pool);
+
+  if (--root->_refs > 0)
+  {
+    return;
+  }
+
+  // walk the tree of joined pools, keeping the ones still to be freed
+  // in a stack linked through their siblings
+  struct kc_node_pool_t* pending = root;
+
+  while (pending != NULL)
+  {
+    struct kc_node_pool_t* current = pending;
+    pending = current->_sibling;
+
+    struct kc_node_pool_t* joined = current->_joined;
+    while (joined != NULL)
+    {
+      struct kc_node_pool_t* next = joined->_sibling;
+      joined->_sibling = pending;
+      pending = joined;
+      joined = next;
+    }
+
+    _free_pool_chunks(current);
+    free(current);
+  }
+}
 
-    // free the node instances
-    free(new_node);
+//---------------------------------------------------------------------------//
 
+int join_node_pools(struct kc_node_pool_t* pool, struct kc_node_pool_t* other)
+{
+  if (pool == NULL || other == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  struct kc_node_pool_t* root = _find_pool_root(pool);
+  struct kc_node_pool_t* other_root = _find_pool_root(other);
+
+  // the pools may have been joined already
+  if (root == other_root)
+  {
+    return KC_SUCCESS;
+  }
+
+  // the nodes can only move between pools of the same kind
+  if (root->_slot_size != other_root->_slot_size)
+  {
+    log_error(KC_UNDERFLOW_LOG);
+    return KC_INVALID;
+  }
+
+  other_root->_parent  = root;
+  other_root->_sibling = root->_joined;
+  root->_joined = other_root;
+  root->_refs += other_root->_refs;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_node_t* pooled_node_constructor(struct kc_node_pool_t* pool, void* data, size_t size)
+{
+  if (pool == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return NULL;
+  }
+
+  if (size < 1)
+  {
+    log_error(KC_UNDERFLOW_LOG);
     return NULL;
   }
 
+  // allocate a new chunk when there are no released nodes left
+  if (pool->_free == NULL)
+  {
+    // the chunk header keeps the nodes aligned
+    size_t header = 2 * sizeof(void*);
+
+    unsigned char* chunk = malloc(header + KC_NODE_POOL_CHUNK_SIZE * pool->_slot_size);
+
+    if (chunk == NULL)
+    {
+      log_error(KC_OUT_OF_MEMORY_LOG);
+      return NULL;
+    }
+
+    // link the chunk, then push its nodes in reverse, so they are
+    // handed out in the order of their addresses
+    *(void**)chunk = pool->_chunks;
+    pool->_chunks = chunk;
+
+    for (size_t i = KC_NODE_POOL_CHUNK_SIZE; i > 0; --i)
+    {
+      void* node = chunk + header + (i - 1) * pool->_slot_size;
+      *(void**)node = pool->_free;
+      pool->_free = node;
+    }
+  }
+
+  struct kc_node_t* new_node = pool->_free;
+
+  // small data is stored inside the slot, right after the node,
+  // only the bigger one needs an allocation of its own
+  if (size <= KC_NODE_INLINE_SIZE)
+  {
+    new_node->data = (unsigned char*)new_node + pool->_node_size;
+  }
+  else
+  {
+    new_node->data = malloc(size);
+
+    if (new_node->data == NULL)
+    {
+      log_error(KC_OUT_OF_MEMORY_LOG);
+      return NULL;
+    }
+  }
+
+  // take the node from the free list only now that it can't fail
+  pool->_free = *(void**)new_node;
+
   // copy the block of memory
   memcpy(new_node->data, data, size);
 
@@ -55,17 +270,88 @@ struct kc_node_t* node_constructor(void* data, size_t size)
 
 //---------------------------------------------------------------------------//
 
-void node_destructor(struct kc_node_t* node)
+void pooled_node_destructor(struct kc_node_pool_t* pool, struct kc_node_t* node)
 {
   // destroy node only if is not dereferenced
-  if (node == NULL)
+  if (pool == NULL || node == NULL)
   {
     log_error(KC_NULL_REFERENCE_LOG);
     return;
   }
 
-  free(node->data);
-  free(node);
+  pooled_node_free_data(pool, node);
+
+  // put the node back into the free list
+  *(void**)node = pool->_free;
+  pool->_free = node;
+}
+
+//---------------------------------------------------------------------------//
+
+void pooled_node_free_data(struct kc_node_pool_t* pool, struct kc_node_t* node)
+{
+  if (pool == NULL || node == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return;
+  }
+
+  // only the data that doesn't live inside the slot was allocated
+  if (node->data != (unsigned char*)node + pool->_node_size)
+  {
+    free(node->data);
+  }
+
+  node->data = NULL;
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_node_pool_t* _find_pool_root(struct kc_node_pool_t* pool)
+{
+  struct kc_node_pool_t* root = pool;
+  while (root->_parent != NULL)
+  {
+    root = root->_parent;
+  }
+
+  // point the pools on the way straight to the root, so the next
+  // searches are shorter
+  while (pool != root)
+  {
+    struct kc_node_pool_t* parent = pool->_parent;
+    pool->_parent = root;
+    pool = parent;
+  }
+
+  return root;
+}
+
+//---------------------------------------------------------------------------//
+
+void _free_pool_chunks(struct kc_node_pool_t* pool)
+{
+  // every chunk starts with a pointer to the next one
+  void* chunk = pool->_chunks;
+  while (chunk != NULL)
+  {
+    void* next = *(void**)chunk;
+    free(chunk);
+    chunk = next;
+  }
+
+  pool->_chunks = NULL;
+  pool->_free   = NULL;
+}
+
+//---------------------------------------------------------------------------//
+
+size_t _node_header_size(size_t node_size)
+{
+  // keep the data that follows the node aligned as malloc would
+  size_t align = 2 * sizeof(void*);
+
+  return (node_size + align - 1) / align * align;
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,396 @@
+// This file is part of keepcoding_core
+// ==================================
+//
+// pqueue.c
+//
+// Copyright (c) 2024 Daniel Tanase
+// SPDX-License-Identifier: MIT License
+
+#include "../../hdrs/datastructs/pqueue.h"
+#include "../../hdrs/common.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//--- MARK: PUBLIC FUNCTION PROTOTYPES --------------------------------------//
+
+static int get_length_pqueue     (struct kc_pqueue_t* self, size_t* length);
+static int get_top_item_pqueue   (struct kc_pqueue_t* self, void** top);
+static int insert_item_pqueue    (struct kc_pqueue_t* self, void* data, size_t size);
+static int insert_items_pqueue   (struct kc_pqueue_t* self, void* data, size_t count);
+static int remove_top_item_pqueue(struct kc_pqueue_t* self);
+
+//--- MARK: PRIVATE FUNCTION PROTOTYPES -------------------------------------//
+
+static void* _heap_at     (struct kc_pqueue_t* pqueue, size_t index);
+static void  _heapify     (struct kc_pqueue_t* pqueue);
+static void  _sift_down   (struct kc_pqueue_t* pqueue, size_t index);
+static void  _sift_up     (struct kc_pqueue_t* pqueue, size_t index);
+
+//---------------------------------------------------------------------------//
+
+struct kc_pqueue_t* new_pqueue(int (*compare)(const void* a, const void* b), size_t elem_size)
+{
+  // create a Priority Queue instance to be returned
+  struct kc_pqueue_t* new_pqueue = malloc(sizeof(struct kc_pqueue_t));
+
+  // confirm that there is memory to allocate
+  if (new_pqueue == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return NULL;
+  }
+
+  // instantiate the priority queue's Vector via the constructor
+  new_pqueue->_vector = new_vector_of(elem_size);
+
+  if (new_pqueue->_vector == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+
+    free(new_pqueue);
+
+    return NULL;
+  }
+
+  new_pqueue->_logger = new_logger(KC_PQUEUE_LOG_PATH);
+
+  if (new_pqueue->_logger == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+
+    destroy_vector(new_pqueue->_vector);
+    free(new_pqueue);
+
+    return NULL;
+  }
+
+  // the item being moved around the heap is kept aside
+  new_pqueue->_item = malloc(elem_size);
+
+  if (new_pqueue->_item == NULL)
+  {
+    log_error(KC_OUT_OF_MEMORY_LOG);
+
+    destroy_logger(new_pqueue->_logger);
+    destroy_vector(new_pqueue->_vector);
+    free(new_pqueue);
+
+    return NULL;
+  }
+
+  // assigns the public member methods
+  new_pqueue->compare = compare;
+  new_pqueue->length  = get_length_pqueue;
+  new_pqueue->pop     = remove_top_item_pqueue;
+  new_pqueue->push    = insert_item_pqueue;
+  new_pqueue->push_n  = insert_items_pqueue;
+  new_pqueue->top     = get_top_item_pqueue;
+
+  return new_pqueue;
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_pqueue_t* new_pqueue_from_vector(int (*compare)(const void* a, const void* b),
+    struct kc_vector_t* vector)
+{
+  // if the vector reference is NULL, do nothing
+  if (vector == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return NULL;
+  }
+
+  // only the vectors that store the items inline can be copied at once
+  if (vector->_elem_size == 0)
+  {
+    log_error(KC_UNDERFLOW_LOG);
+    return NULL;
+  }
+
+  struct kc_pqueue_t* pqueue = new_pqueue(compare, vector->_elem_size);
+
+  if (pqueue == NULL)
+  {
+    return NULL; /* an error has already been displayed */
+  }
+
+  // copy all the items at once and arrange them in linear time
+  int ret = insert_items_pqueue(pqueue, vector->data, vector->length);
+
+  if (ret != KC_SUCCESS)
+  {
+    destroy_pqueue(pqueue);
+    return NULL;
+  }
+
+  return pqueue;
+}
+
+//---------------------------------------------------------------------------//
+
+void destroy_pqueue(struct kc_pqueue_t* pqueue)
+{
+  // if the priority queue reference is NULL, do nothing
+  if (pqueue == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return;
+  }
+
+  destroy_logger(pqueue->_logger);
+  destroy_vector(pqueue->_vector);
+
+  free(pqueue->_item);
+  free(pqueue);
+}
+
+//---------------------------------------------------------------------------//
+
+int get_length_pqueue(struct kc_pqueue_t* self, size_t* length)
+{
+  // if the priority queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  (*length) = self->_vector->length;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int get_top_item_pqueue(struct kc_pqueue_t* self, void** top)
+{
+  // if the priority queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // the greatest item is always the root of the heap
+  int ret = self->_vector->front(self->_vector, top);
+  if (ret != KC_SUCCESS)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, ret,
+      __FILE__, __LINE__, __func__);
+
+    return ret;
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int insert_item_pqueue(struct kc_pqueue_t* self, void* data, size_t size)
+{
+  // if the priority queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // add the item as the last leaf of the heap
+  int ret = self->_vector->push_back(self->_vector, data, size);
+  if (ret != KC_SUCCESS)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, ret,
+      __FILE__, __LINE__, __func__);
+
+    return ret;
+  }
+
+  _sift_up(self, self->_vector->length - 1);
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int insert_items_pqueue(struct kc_pqueue_t* self, void* data, size_t count)
+{
+  // if the priority queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  if (count == 0)
+  {
+    return KC_SUCCESS;
+  }
+
+  struct kc_vector_t* vector = self->_vector;
+  size_t old_length = vector->length;
+
+  // copy all the items at once after the last leaf
+  int ret = vector->append_n(vector, data, count, vector->_elem_size);
+  if (ret != KC_SUCCESS)
+  {
+    return ret; /* an error has already been displayed */
+  }
+
+  // a few items are sifted up one by one, but when many items are added
+  // rebuilding the whole heap in linear time is cheaper
+  if (count < vector->length / 8)
+  {
+    for (size_t i = old_length; i < vector->length; ++i)
+    {
+      _sift_up(self, i);
+    }
+  }
+  else
+  {
+    _heapify(self);
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int remove_top_item_pqueue(struct kc_pqueue_t* self)
+{
+  // if the priority queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // make sure the priority queue is not empty
+  if (self->_vector->length == 0)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_EMPTY_STRUCTURE,
+      __FILE__, __LINE__, __func__);
+
+    return KC_EMPTY_STRUCTURE;
+  }
+
+  // move the last leaf to the root and sift it down, unless the root is
+  // the last leaf itself
+  size_t last = self->_vector->length - 1;
+  if (last > 0)
+  {
+    memcpy(_heap_at(self, 0), _heap_at(self, last), self->_vector->_elem_size);
+  }
+
+  int ret = self->_vector->pop_back(self->_vector);
+  if (ret != KC_SUCCESS)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, ret,
+      __FILE__, __LINE__, __func__);
+
+    return ret;
+  }
+
+  if (self->_vector->length > 1)
+  {
+    _sift_down(self, 0);
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+void* _heap_at(struct kc_pqueue_t* pqueue, size_t index)
+{
+  return (char*)pqueue->_vector->data + index * pqueue->_vector->_elem_size;
+}
+
+//---------------------------------------------------------------------------//
+
+void _heapify(struct kc_pqueue_t* pqueue)
+{
+  size_t length = pqueue->_vector->length;
+
+  if (length < 2)
+  {
+    return;
+  }
+
+  // sift down every parent, starting from the last one
+  for (size_t i = (length - 2) / KC_PQUEUE_ARITY + 1; i > 0; --i)
+  {
+    _sift_down(pqueue, i - 1);
+  }
+}
+
+//---------------------------------------------------------------------------//
+
+void _sift_down(struct kc_pqueue_t* pqueue, size_t index)
+{
+  size_t length    = pqueue->_vector->length;
+  size_t elem_size = pqueue->_vector->_elem_size;
+
+  // keep the item aside and move the greater children up instead of swapping
+  memcpy(pqueue->_item, _heap_at(pqueue, index), elem_size);
+
+  for (;;)
+  {
+    size_t first = index * KC_PQUEUE_ARITY + 1;
+
+    if (first >= length)
+    {
+      break;
+    }
+
+    // find the greatest of the children
+    size_t last     = first + KC_PQUEUE_ARITY < length ? first + KC_PQUEUE_ARITY : length;
+    size_t greatest = first;
+
+    for (size_t child = first + 1; child < last; ++child)
+    {
+      if (pqueue->compare(_heap_at(pqueue, child), _heap_at(pqueue, greatest)) > 0)
+      {
+        greatest = child;
+      }
+    }
+
+    if (pqueue->compare(_heap_at(pqueue, greatest), pqueue->_item) <= 0)
+    {
+      break;
+    }
+
+    memcpy(_heap_at(pqueue, index), _heap_at(pqueue, greatest), elem_size);
+    index = greatest;
+  }
+
+  memcpy(_heap_at(pqueue, index), pqueue->_item, elem_size);
+}
+
+//---------------------------------------------------------------------------//
+
+void _sift_up(struct kc_pqueue_t* pqueue, size_t index)
+{
+  size_t elem_size = pqueue->_vector->_elem_size;
+
+  // keep the item aside and move the smaller parents down instead of swapping
+  memcpy(pqueue->_item, _heap_at(pqueue, index), elem_size);
+
+  while (index > 0)
+  {
+    size_t parent = (index - 1) / KC_PQUEUE_ARITY;
+
+    if (pqueue->compare(pqueue->_item, _heap_at(pqueue, parent)) <= 0)
+    {
+      break;
+    }
+
+    memcpy(_heap_at(pqueue, index), _heap_at(pqueue, parent), elem_size);
+    index = parent;
+  }
+
+  memcpy(_heap_at(pqueue, index), pqueue->_item, elem_size);
+}
+
+//---------------------------------------------------------------------------//
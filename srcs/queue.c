@@ -10,6 +10,14 @@
 #include "../../hdrs/common.h"
 
 #include <stdlib.h>
+#include <string.h>
+
+//---------------------------------------------------------------------------//
+
+// every item of the ring buffer is preceded by its size, and both are
+// padded so the items stay aligned for any type
+#define KC_QUEUE_ALIGN     16
+#define KC_QUEUE_CAPACITY  256
 
 //--- MARK: PUBLIC FUNCTION PROTOTYPES --------------------------------------//
 
@@ -18,6 +26,16 @@ static int get_next_item_queue     (struct kc_queue_t* self, void** peek);
 static int insert_next_item_queue  (struct kc_queue_t* self, void* data, size_t size);
 static int remove_next_item_queue  (struct kc_queue_t* self);
 
+static int get_ring_length_queue   (struct kc_queue_t* self, size_t* length);
+static int get_next_item_ring      (struct kc_queue_t* self, void** peek);
+static int insert_next_item_ring   (struct kc_queue_t* self, void* data, size_t size);
+static int remove_next_item_ring   (struct kc_queue_t* self);
+
+//--- MARK: PRIVATE FUNCTION PROTOTYPES -------------------------------------//
+
+static int    _grow_ring    (struct kc_queue_t* queue, size_t min_capacity);
+static size_t _record_size  (size_t size);
+
 //---------------------------------------------------------------------------//
 
 struct kc_queue_t* new_queue()
@@ -58,6 +76,15 @@ struct kc_queue_t* new_queue()
     return NULL;
   }
 
+  // the ring buffer is not used by the list queue
+  new_queue->_buffer   = NULL;
+  new_queue->_capacity = 0;
+  new_queue->_head     = 0;
+  new_queue->_tail     = 0;
+  new_queue->_end      = 0;
+  new_queue->_length   = 0;
+  new_queue->_wrapped  = false;
+
   // assigns the public member methods
   new_queue->length = get_list_length_queue;
   new_queue->peek   = get_next_item_queue;
@@ -69,6 +96,63 @@ struct kc_queue_t* new_queue()
 
 //---------------------------------------------------------------------------//
 
+struct kc_queue_t* new_ring_queue()
+{
+  // create a Queue instance to be returned
+  struct kc_queue_t* new_queue = malloc(sizeof(struct kc_queue_t));
+
+  // confirm that there is memory to allocate
+  if (new_queue == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return NULL;
+  }
+
+  new_queue->_logger = new_logger(KC_QUEUE_LOG_PATH);
+
+  if (new_queue->_logger == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+
+    // free the queue instance
+    free(new_queue);
+
+    return NULL;
+  }
+
+  // the items are kept in the ring buffer instead of a List
+  new_queue->_list     = NULL;
+  new_queue->_buffer   = malloc(KC_QUEUE_CAPACITY);
+  new_queue->_capacity = KC_QUEUE_CAPACITY;
+  new_queue->_head     = 0;
+  new_queue->_tail     = 0;
+  new_queue->_end      = 0;
+  new_queue->_length   = 0;
+  new_queue->_wrapped  = false;
+
+  // confirm that there is memory to allocate
+  if (new_queue->_buffer == NULL)
+  {
+    log_error(KC_OUT_OF_MEMORY_LOG);
+
+    // free the queue instances
+    destroy_logger(new_queue->_logger);
+    free(new_queue);
+
+    return NULL;
+  }
+
+  // assigns the public member methods
+  new_queue->length = get_ring_length_queue;
+  new_queue->peek   = get_next_item_ring;
+  new_queue->pop    = remove_next_item_ring;
+  new_queue->push   = insert_next_item_ring;
+
+  return new_queue;
+}
+
+//---------------------------------------------------------------------------//
+
 void destroy_queue(struct kc_queue_t* queue)
 {
   // if the list reference is NULL, do nothing
@@ -81,7 +165,13 @@ void destroy_queue(struct kc_queue_t* queue)
   }
 
   destroy_logger(queue->_logger);
-  destroy_list(queue->_list);
+
+  if (queue->_list != NULL)
+  {
+    destroy_list(queue->_list);
+  }
+
+  free(queue->_buffer);
   free(queue);
 }
 
@@ -181,3 +271,198 @@ int remove_next_item_queue(struct kc_queue_t *self)
 
 //---------------------------------------------------------------------------//
 
+int get_ring_length_queue(struct kc_queue_t* self, size_t* length)
+{
+  // if the queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  (*length) = self->_length;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int get_next_item_ring(struct kc_queue_t* self, void** peek)
+{
+  // if the queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  if (self->_length == 0)
+  {
+    return KC_EMPTY_STRUCTURE;
+  }
+
+  // the item starts right after its size
+  (*peek) = self->_buffer + self->_head + KC_QUEUE_ALIGN;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int insert_next_item_ring(struct kc_queue_t* self, void* data, size_t size)
+{
+  // if the queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // confirm the size of the data is at least one
+  if (size < 1)
+  {
+    self->_logger->log(self->_logger, KC_ERROR_LOG, KC_UNDERFLOW,
+      __FILE__, __LINE__, __func__);
+
+    return KC_UNDERFLOW;
+  }
+
+  size_t record = _record_size(size);
+
+  // the free space is after the tail and, if the buffer didn't wrap yet,
+  // also at the beginning of the buffer (before the head)
+  if (self->_wrapped == false && self->_capacity - self->_tail < record)
+  {
+    if (self->_head >= record)
+    {
+      // leave the end of the buffer unused and continue from the beginning
+      self->_end     = self->_tail;
+      self->_tail    = 0;
+      self->_wrapped = true;
+    }
+    else if (_grow_ring(self, record) != KC_SUCCESS)
+    {
+      self->_logger->log(self->_logger, KC_ERROR_LOG, KC_OUT_OF_MEMORY,
+        __FILE__, __LINE__, __func__);
+
+      return KC_OUT_OF_MEMORY;
+    }
+  }
+  else if (self->_wrapped == true && self->_head - self->_tail < record)
+  {
+    if (_grow_ring(self, record) != KC_SUCCESS)
+    {
+      self->_logger->log(self->_logger, KC_ERROR_LOG, KC_OUT_OF_MEMORY,
+        __FILE__, __LINE__, __func__);
+
+      return KC_OUT_OF_MEMORY;
+    }
+  }
+
+  // store the size of the item followed by the item itself
+  memcpy(self->_buffer + self->_tail, &size, sizeof(size_t));
+  memcpy(self->_buffer + self->_tail + KC_QUEUE_ALIGN, data, size);
+
+  self->_tail += record;
+  ++self->_length;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int remove_next_item_ring(struct kc_queue_t* self)
+{
+  // if the queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // make sure the queue is not empty
+  if (self->_length == 0)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_EMPTY_STRUCTURE,
+      __FILE__, __LINE__, __func__);
+
+    return KC_EMPTY_STRUCTURE;
+  }
+
+  size_t size = 0;
+  memcpy(&size, self->_buffer + self->_head, sizeof(size_t));
+
+  self->_head += _record_size(size);
+  --self->_length;
+
+  if (self->_length == 0)
+  {
+    // start again from the beginning of the buffer
+    self->_head    = 0;
+    self->_tail    = 0;
+    self->_wrapped = false;
+  }
+  else if (self->_wrapped == true && self->_head == self->_end)
+  {
+    // the head reached the unused end of the buffer
+    self->_head    = 0;
+    self->_wrapped = false;
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int _grow_ring(struct kc_queue_t* queue, size_t min_capacity)
+{
+  size_t new_capacity = queue->_capacity * 2;
+  while (new_capacity - queue->_capacity < min_capacity)
+  {
+    new_capacity *= 2;
+  }
+
+  unsigned char* new_buffer = malloc(new_capacity);
+
+  if (new_buffer == NULL)
+  {
+    return KC_OUT_OF_MEMORY;
+  }
+
+  // copy the items in order, so they start from the beginning of the buffer
+  size_t used = 0;
+
+  if (queue->_wrapped == true)
+  {
+    memcpy(new_buffer, queue->_buffer + queue->_head, queue->_end - queue->_head);
+    used = queue->_end - queue->_head;
+
+    memcpy(new_buffer + used, queue->_buffer, queue->_tail);
+    used += queue->_tail;
+  }
+  else
+  {
+    memcpy(new_buffer, queue->_buffer + queue->_head, queue->_tail - queue->_head);
+    used = queue->_tail - queue->_head;
+  }
+
+  free(queue->_buffer);
+
+  queue->_buffer   = new_buffer;
+  queue->_capacity = new_capacity;
+  queue->_head     = 0;
+  queue->_tail     = used;
+  queue->_wrapped  = false;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+size_t _record_size(size_t size)
+{
+  // the size of the item, followed by the item, both padded
+  return KC_QUEUE_ALIGN + (size + KC_QUEUE_ALIGN - 1) / KC_QUEUE_ALIGN * KC_QUEUE_ALIGN;
+}
+
+//---------------------------------------------------------------------------//
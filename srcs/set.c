@@ -12,15 +12,46 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+//---------------------------------------------------------------------------//
+
+// the hash table is probed in groups of control bytes, each control byte is
+// either empty, deleted or holds the lowest 7 bits of the hash of its slot
+#define KC_SET_GROUP_WIDTH   16
+#define KC_SET_CTRL_EMPTY    ((int8_t)-128)
+#define KC_SET_CTRL_DELETED  ((int8_t)-2)
+
 //--- MARK: PUBLIC FUNCTION PROTOTYPES --------------------------------------//
 
-static int insert_new_pair_set  (struct kc_set_t* self, void* key, size_t key_size, void* value, size_t value_size);
-static int remove_pair_set      (struct kc_set_t* self, void* key, size_t key_size);
-static int search_pair_set      (struct kc_set_t* self, void* key, size_t key_size, void** data);
+static int first_pair_set            (struct kc_set_t* self, struct kc_node_t** node);
+static int insert_new_pair_set       (struct kc_set_t* self, void* key, size_t key_size, void* value, size_t value_size);
+static int insert_new_pair_hash_set  (struct kc_set_t* self, void* key, size_t key_size, void* value, size_t value_size);
+static int last_pair_set             (struct kc_set_t* self, struct kc_node_t** node);
+static int lower_bound_set           (struct kc_set_t* self, void* key, struct kc_node_t** node);
+static int next_pair_set             (struct kc_set_t* self, struct kc_node_t** node);
+static int prev_pair_set             (struct kc_set_t* self, struct kc_node_t** node);
+static int range_set                 (struct kc_set_t* self, void* low, void* high, int (*callback)(void* key, void* value, void* context), void* context);
+static int remove_pair_set           (struct kc_set_t* self, void* key, size_t key_size);
+static int remove_pair_hash_set      (struct kc_set_t* self, void* key, size_t key_size);
+static int search_pair_set           (struct kc_set_t* self, void* key, size_t key_size, void** data);
+static int search_pair_hash_set      (struct kc_set_t* self, void* key, size_t key_size, void** data);
+static int upper_bound_set           (struct kc_set_t* self, void* key, struct kc_node_t** node);
 
 //--- MARK: PRIVATE FUNCTION PROTOTYPES -------------------------------------//
 
-static void _recursive_set_destroy  (struct kc_node_t* node);
+static int      _check_ordered_set      (struct kc_set_t* set);
+static void     _destroy_set_entries    (struct kc_set_t* set);
+static int      _find_slot_hash_set     (struct kc_set_t* set, void* key, size_t hash, size_t* index);
+static size_t   _find_free_slot_hash_set(struct kc_set_t* set, size_t hash);
+static unsigned _group_match            (const int8_t* group, int8_t control);
+static unsigned _group_match_free       (const int8_t* group);
+static size_t   _hash_key_bytes         (const void* key, size_t key_size);
+static int      _lowest_bit             (unsigned mask);
+static int      _rehash_set             (struct kc_set_t* set, size_t new_capacity);
+static int      _search_node_set        (struct kc_set_t* set, void* key, struct kc_node_t** node);
 
 //---------------------------------------------------------------------------//
 
@@ -49,8 +80,8 @@ struct kc_set_t* new_set(int (*compare)(const void* a, const void* b))
     return NULL;
   }
 
-  // instantiate the set's kc_tree_t via the constructor
-  new_set->_entries = new_tree(compare);
+  // instantiate the set's balanced kc_tree_t via the constructor
+  new_set->_entries = new_rb_tree(compare);
 
   if (new_set->_entries == NULL)
   {
@@ -63,10 +94,184 @@ struct kc_set_t* new_set(int (*compare)(const void* a, const void* b))
     return NULL;
   }
 
+  // the hash table is not used by the ordered set
+  new_set->_control     = NULL;
+  new_set->_slots       = NULL;
+  new_set->_capacity    = 0;
+  new_set->_growth_left = 0;
+  new_set->_length      = 0;
+  new_set->_compare     = compare;
+  new_set->_hash        = NULL;
+
   // assigns the public member methods
-  new_set->insert = insert_new_pair_set;
-  new_set->remove = remove_pair_set;
-  new_set->search = search_pair_set;
+  new_set->insert      = insert_new_pair_set;
+  new_set->remove      = remove_pair_set;
+  new_set->search      = search_pair_set;
+  new_set->first       = first_pair_set;
+  new_set->last        = last_pair_set;
+  new_set->lower_bound = lower_bound_set;
+  new_set->next        = next_pair_set;
+  new_set->prev        = prev_pair_set;
+  new_set->range       = range_set;
+  new_set->upper_bound = upper_bound_set;
+
+  return new_set;
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_set_t* new_set_from_sorted(int (*compare)(const void* a, const void* b),
+    void* keys, void* values, size_t count, size_t key_size, size_t value_size)
+{
+  if ((keys == NULL || values == NULL) && count > 0)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return NULL;
+  }
+
+  if (key_size < 1 || value_size < 1)
+  {
+    log_error(KC_UNDERFLOW_LOG);
+    return NULL;
+  }
+
+  struct kc_set_t* new_set_sorted = new_set(compare);
+
+  if (new_set_sorted == NULL)
+  {
+    return NULL; /* an error has already been displayed */
+  }
+
+  // the tree copies the pairs, but the keys and values are owned by the set,
+  // so every pair gets its own copies before building the tree
+  struct kc_pair_t* pairs = malloc((count > 0 ? count : 1) * sizeof(struct kc_pair_t));
+
+  if (pairs == NULL)
+  {
+    log_error(KC_OUT_OF_MEMORY_LOG);
+
+    destroy_set(new_set_sorted);
+
+    return NULL;
+  }
+
+  size_t copied = 0;
+
+  for (; copied < count; ++copied)
+  {
+    pairs[copied].key   = malloc(key_size);
+    pairs[copied].value = malloc(value_size);
+
+    if (pairs[copied].key == NULL || pairs[copied].value == NULL)
+    {
+      log_error(KC_OUT_OF_MEMORY_LOG);
+
+      free(pairs[copied].key);
+      free(pairs[copied].value);
+
+      break;
+    }
+
+    memcpy(pairs[copied].key, (unsigned char*)keys + copied * key_size, key_size);
+    memcpy(pairs[copied].value, (unsigned char*)values + copied * value_size, value_size);
+  }
+
+  struct kc_tree_t* entries = NULL;
+
+  if (copied == count)
+  {
+    entries = new_tree_from_sorted(compare, pairs, count, sizeof(struct kc_pair_t));
+  }
+
+  // without a tree, nobody took the ownership of the copies, an error
+  // has already been displayed
+  if (entries == NULL)
+  {
+    while (copied > 0)
+    {
+      --copied;
+      free(pairs[copied].key);
+      free(pairs[copied].value);
+    }
+
+    free(pairs);
+    destroy_set(new_set_sorted);
+
+    return NULL;
+  }
+
+  free(pairs);
+
+  // replace the empty tree with the one that was just built
+  destroy_tree(new_set_sorted->_entries);
+  new_set_sorted->_entries = entries;
+
+  return new_set_sorted;
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_set_t* new_hash_set(size_t (*hash)(const void* key, size_t key_size),
+    int (*compare)(const void* a, const void* b))
+{
+  // create a Set instance to be returned
+  struct kc_set_t* new_set = malloc(sizeof(struct kc_set_t));
+
+  // confirm that there is memory to allocate
+  if (new_set == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return NULL;
+  }
+
+  // create a console log instance to be used for the set
+  new_set->_logger = new_logger(KC_SET_LOG_PATH);
+
+  if (new_set->_logger == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+
+    // free the set instance
+    free(new_set);
+
+    return NULL;
+  }
+
+  // the hash set doesn't need a tree, the pairs are kept in the table
+  new_set->_entries     = NULL;
+  new_set->_control     = NULL;
+  new_set->_slots       = NULL;
+  new_set->_capacity    = 0;
+  new_set->_growth_left = 0;
+  new_set->_length      = 0;
+  new_set->_compare     = compare;
+  new_set->_hash        = hash != NULL ? hash : _hash_key_bytes;
+
+  // allocate the first group of slots
+  if (_rehash_set(new_set, KC_SET_GROUP_WIDTH) != KC_SUCCESS)
+  {
+    log_error(KC_OUT_OF_MEMORY_LOG);
+
+    // free the set instances
+    destroy_logger(new_set->_logger);
+    free(new_set);
+
+    return NULL;
+  }
+
+  // assigns the public member methods
+  new_set->insert      = insert_new_pair_hash_set;
+  new_set->remove      = remove_pair_hash_set;
+  new_set->search      = search_pair_hash_set;
+
+  // the ordered functions only report that the hash set has no order
+  new_set->first       = first_pair_set;
+  new_set->last        = last_pair_set;
+  new_set->lower_bound = lower_bound_set;
+  new_set->next        = next_pair_set;
+  new_set->prev        = prev_pair_set;
+  new_set->range       = range_set;
+  new_set->upper_bound = upper_bound_set;
 
   return new_set;
 }
@@ -84,9 +289,26 @@ void destroy_set(struct kc_set_t* set)
   }
 
   // free the binary tree memory
-  if (set->_entries->root != NULL)
+  if (set->_entries != NULL)
   {
-    _recursive_set_destroy(set->_entries->root);
+    _destroy_set_entries(set);
+    destroy_tree(set->_entries);
+  }
+
+  // free the hash table memory
+  if (set->_control != NULL)
+  {
+    for (size_t i = 0; i < set->_capacity; ++i)
+    {
+      if (set->_control[i] >= 0)
+      {
+        free(set->_slots[i].pair.key);
+        free(set->_slots[i].pair.value);
+      }
+    }
+
+    free(set->_control);
+    free(set->_slots);
   }
 
   destroy_logger(set->_logger);
@@ -97,6 +319,27 @@ void destroy_set(struct kc_set_t* set)
 
 //---------------------------------------------------------------------------//
 
+int first_pair_set(struct kc_set_t* self, struct kc_node_t** node)
+{
+  // if the set reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  int ret = _check_ordered_set(self);
+  if (ret != KC_SUCCESS)
+  {
+    return ret; /* an error has already been displayed */
+  }
+
+  // the pairs are ordered by the keys inside the tree
+  return self->_entries->first(self->_entries, node);
+}
+
+//---------------------------------------------------------------------------//
+
 int insert_new_pair_set(struct kc_set_t* self, void* key, size_t key_size, void* value, size_t value_size)
 {
   // if the set reference is NULL, do nothing
@@ -108,7 +351,7 @@ int insert_new_pair_set(struct kc_set_t* self, void* key, size_t key_size, void*
 
   // check if the pair already exists in the set
   struct kc_node_t* node = NULL;
-  int ret = search_pair_set(self, key, key_size, &node->data);
+  int ret = _search_node_set(self, key, &node);
   if (ret != KC_SUCCESS)
   {
     self->_logger->log(self->_logger, KC_WARNING_LOG, ret,
@@ -125,8 +368,15 @@ int insert_new_pair_set(struct kc_set_t* self, void* key, size_t key_size, void*
   // create a new Pair
   struct kc_pair_t* pair = pair_constructor(key, key_size, value, value_size);
 
-  // insert that pair into the tree
+  if (pair == NULL)
+  {
+    return KC_INVALID; /* an error has already been displayed */
+  }
+
+  // insert that pair into the tree, the node keeps a copy of the pair
+  // and takes the ownership of its key and value
   ret = self->_entries->insert(self->_entries, pair, sizeof(struct kc_pair_t));
+  free(pair);
 
   if (ret != KC_SUCCESS)
   {
@@ -141,6 +391,215 @@ int insert_new_pair_set(struct kc_set_t* self, void* key, size_t key_size, void*
 
 //---------------------------------------------------------------------------//
 
+int insert_new_pair_hash_set(struct kc_set_t* self, void* key, size_t key_size, void* value, size_t value_size)
+{
+  // if the set reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // confirm the size of the data is at least one
+  if (key_size < 1 || value_size < 1)
+  {
+    self->_logger->log(self->_logger, KC_ERROR_LOG, KC_UNDERFLOW,
+      __FILE__, __LINE__, __func__);
+
+    return KC_UNDERFLOW;
+  }
+
+  // check if the pair already exists in the set
+  size_t hash  = self->_hash(key, key_size);
+  size_t index = 0;
+
+  if (_find_slot_hash_set(self, key, hash, &index) == KC_SUCCESS)
+  {
+    return KC_SUCCESS;
+  }
+
+  // grow the table (or clear the deleted slots) when it gets too full
+  if (self->_growth_left == 0)
+  {
+    size_t new_capacity = self->_length >= (self->_capacity - self->_capacity / 8) / 2 ?
+        self->_capacity * 2 : self->_capacity;
+
+    int ret = _rehash_set(self, new_capacity);
+    if (ret != KC_SUCCESS)
+    {
+      self->_logger->log(self->_logger, KC_ERROR_LOG, ret,
+        __FILE__, __LINE__, __func__);
+
+      return ret;
+    }
+  }
+
+  // copy the key and the value into the set
+  void* new_key   = malloc(key_size);
+  void* new_value = malloc(value_size);
+
+  if (new_key == NULL || new_value == NULL)
+  {
+    self->_logger->log(self->_logger, KC_ERROR_LOG, KC_OUT_OF_MEMORY,
+      __FILE__, __LINE__, __func__);
+
+    free(new_key);
+    free(new_value);
+
+    return KC_OUT_OF_MEMORY;
+  }
+
+  memcpy(new_key, key, key_size);
+  memcpy(new_value, value, value_size);
+
+  // place the pair in the first free slot of its probe sequence
+  index = _find_free_slot_hash_set(self, hash);
+
+  if (self->_control[index] == KC_SET_CTRL_EMPTY)
+  {
+    --self->_growth_left;
+  }
+
+  self->_control[index]         = (int8_t)(hash & 0x7F);
+  self->_slots[index].pair.key   = new_key;
+  self->_slots[index].pair.value = new_value;
+  self->_slots[index].hash       = hash;
+  ++self->_length;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int last_pair_set(struct kc_set_t* self, struct kc_node_t** node)
+{
+  // if the set reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  int ret = _check_ordered_set(self);
+  if (ret != KC_SUCCESS)
+  {
+    return ret; /* an error has already been displayed */
+  }
+
+  // the pairs are ordered by the keys inside the tree
+  return self->_entries->last(self->_entries, node);
+}
+
+//---------------------------------------------------------------------------//
+
+int lower_bound_set(struct kc_set_t* self, void* key, struct kc_node_t** node)
+{
+  // if the set reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  int ret = _check_ordered_set(self);
+  if (ret != KC_SUCCESS)
+  {
+    return ret; /* an error has already been displayed */
+  }
+
+  // the compare function only looks at the keys
+  struct kc_pair_t searchable = { key, NULL };
+
+  return self->_entries->lower_bound(self->_entries, &searchable, node);
+}
+
+//---------------------------------------------------------------------------//
+
+int next_pair_set(struct kc_set_t* self, struct kc_node_t** node)
+{
+  // if the set reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  int ret = _check_ordered_set(self);
+  if (ret != KC_SUCCESS)
+  {
+    return ret; /* an error has already been displayed */
+  }
+
+  // move to the pair with the next key
+  return self->_entries->next(self->_entries, node);
+}
+
+//---------------------------------------------------------------------------//
+
+int prev_pair_set(struct kc_set_t* self, struct kc_node_t** node)
+{
+  // if the set reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  int ret = _check_ordered_set(self);
+  if (ret != KC_SUCCESS)
+  {
+    return ret; /* an error has already been displayed */
+  }
+
+  // move to the pair with the previous key
+  return self->_entries->prev(self->_entries, node);
+}
+
+//---------------------------------------------------------------------------//
+
+int range_set(struct kc_set_t* self, void* low, void* high,
+    int (*callback)(void* key, void* value, void* context), void* context)
+{
+  // if the set or the callback reference is NULL, do nothing
+  if (self == NULL || callback == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  int ret = _check_ordered_set(self);
+  if (ret != KC_SUCCESS)
+  {
+    return ret; /* an error has already been displayed */
+  }
+
+  // the limits are only keys, so wrap them as the compare function expects
+  struct kc_pair_t low_pair  = { low, NULL };
+  struct kc_pair_t high_pair = { high, NULL };
+
+  struct kc_tree_t* entries = self->_entries;
+  struct kc_node_t* node    = NULL;
+
+  entries->lower_bound(entries, &low_pair, &node);
+
+  // walk in order until the upper limit or until the callback stops it
+  while (node != NULL && entries->compare(node->data, &high_pair) < 0)
+  {
+    struct kc_pair_t* pair = (struct kc_pair_t*)node->data;
+
+    if (callback(pair->key, pair->value, context) != 0)
+    {
+      break;
+    }
+
+    entries->next(entries, &node);
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
 int remove_pair_set(struct kc_set_t* self, void* key, size_t key_size)
 {
   // if the set reference is NULL, do nothing
@@ -150,18 +609,31 @@ int remove_pair_set(struct kc_set_t* self, void* key, size_t key_size)
     return KC_NULL_REFERENCE;
   }
 
-  // create a new pair by using a dummy value
-  char dummy_value = 'a';
-  struct kc_pair_t* pair_to_remove = pair_constructor(key, key_size,
-      &dummy_value, sizeof(char));
+  // find the pair to be removed
+  struct kc_node_t* node = NULL;
+  int ret = _search_node_set(self, key, &node);
+  if (ret != KC_SUCCESS)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, ret,
+      __FILE__, __LINE__, __func__);
 
-  if (pair_to_remove == NULL)
+    return ret;
+  }
+
+  if (node == NULL)
   {
-    return KC_INVALID;
+    return KC_SUCCESS;
   }
 
+  // the node only frees the pair itself, so free its key and value first,
+  // but keep the key pointer until the tree is done comparing with it
+  struct kc_pair_t removed = *(struct kc_pair_t*)node->data;
+  free(removed.value);
+
   // call the remove function of the Tree structure
-  int ret = self->_entries->remove(self->_entries, pair_to_remove, sizeof(struct kc_pair_t));
+  ret = self->_entries->remove(self->_entries, &removed, sizeof(struct kc_pair_t));
+  free(removed.key);
+
   if (ret != KC_SUCCESS)
   {
     self->_logger->log(self->_logger, KC_WARNING_LOG, ret,
@@ -170,14 +642,12 @@ int remove_pair_set(struct kc_set_t* self, void* key, size_t key_size)
     return ret;
   }
 
-  pair_destructor(pair_to_remove);
-
   return KC_SUCCESS;
 }
 
 //---------------------------------------------------------------------------//
 
-int search_pair_set(struct kc_set_t* self, void* key, size_t key_size, void** value)
+int remove_pair_hash_set(struct kc_set_t* self, void* key, size_t key_size)
 {
   // if the set reference is NULL, do nothing
   if (self == NULL)
@@ -186,22 +656,48 @@ int search_pair_set(struct kc_set_t* self, void* key, size_t key_size, void** va
     return KC_NULL_REFERENCE;
   }
 
-  // create a new pair by using a dummy value
-  char dummy_value = 'a';
-  struct kc_pair_t* searchable = pair_constructor(key, key_size,
-      &dummy_value, sizeof(char));
+  size_t index = 0;
 
-  if (searchable == NULL)
+  if (_find_slot_hash_set(self, key, self->_hash(key, key_size), &index) != KC_SUCCESS)
   {
-    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_OUT_OF_MEMORY,
-      __FILE__, __LINE__, __func__);
+    return KC_SUCCESS;
+  }
 
-    return KC_OUT_OF_MEMORY;
+  free(self->_slots[index].pair.key);
+  free(self->_slots[index].pair.value);
+  --self->_length;
+
+  // a probe only stops at a group that has an empty slot, so if this group
+  // still has one, no probe ever went past it and the slot can be emptied
+  const int8_t* group = self->_control + (index & ~(size_t)(KC_SET_GROUP_WIDTH - 1));
+
+  if (_group_match(group, KC_SET_CTRL_EMPTY) != 0)
+  {
+    self->_control[index] = KC_SET_CTRL_EMPTY;
+    ++self->_growth_left;
+  }
+  else
+  {
+    self->_control[index] = KC_SET_CTRL_DELETED;
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int search_pair_set(struct kc_set_t* self, void* key, size_t key_size, void** value)
+{
+  // if the set reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
   }
 
   // use the search function of the kc_tree_t to find the desired node
   struct kc_node_t* result_node = NULL;
-  int ret = self->_entries->search(self->_entries, searchable, &result_node);
+  int ret = _search_node_set(self, key, &result_node);
   if (ret != KC_SUCCESS)
   {
     self->_logger->log(self->_logger, KC_WARNING_LOG, ret,
@@ -210,9 +706,6 @@ int search_pair_set(struct kc_set_t* self, void* key, size_t key_size, void** va
     return ret;
   }
 
-  // free the dummy pair
-  pair_destructor(searchable);
-
   // make sure the node was found
   if (result_node != NULL)
   {
@@ -224,39 +717,281 @@ int search_pair_set(struct kc_set_t* self, void* key, size_t key_size, void** va
     {
       (*value) = result_pair->value;
     }
-    else
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int search_pair_hash_set(struct kc_set_t* self, void* key, size_t key_size, void** value)
+{
+  // if the set reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  size_t index = 0;
+
+  // return the value for that key, if found
+  if (_find_slot_hash_set(self, key, self->_hash(key, key_size), &index) == KC_SUCCESS)
+  {
+    (*value) = self->_slots[index].pair.value;
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int upper_bound_set(struct kc_set_t* self, void* key, struct kc_node_t** node)
+{
+  // if the set reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  int ret = _check_ordered_set(self);
+  if (ret != KC_SUCCESS)
+  {
+    return ret; /* an error has already been displayed */
+  }
+
+  // the compare function only looks at the keys
+  struct kc_pair_t searchable = { key, NULL };
+
+  return self->_entries->upper_bound(self->_entries, &searchable, node);
+}
+
+//---------------------------------------------------------------------------//
+
+int _check_ordered_set(struct kc_set_t* set)
+{
+  // only the sets backed by a tree keep their pairs in order
+  if (set->_entries == NULL)
+  {
+    set->_logger->log(set->_logger, KC_WARNING_LOG, KC_INVALID,
+      __FILE__, __LINE__, __func__);
+
+    return KC_INVALID;
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+void _destroy_set_entries(struct kc_set_t* set)
+{
+  struct kc_tree_t* entries = set->_entries;
+  struct kc_node_t* node    = NULL;
+
+  // walk the entries in order, so a tree of any height is freed
+  // without recursion
+  entries->first(entries, &node);
+
+  while (node != NULL)
+  {
+    // free the key and value, the pair itself belongs to the node
+    free(((struct kc_pair_t*)node->data)->key);
+    free(((struct kc_pair_t*)node->data)->value);
+
+    entries->next(entries, &node);
+  }
+}
+
+//---------------------------------------------------------------------------//
+
+int _find_slot_hash_set(struct kc_set_t* set, void* key, size_t hash, size_t* index)
+{
+  // the compare function works with pairs, so wrap the key in one
+  struct kc_pair_t searchable = { key, NULL };
+
+  size_t mask  = set->_capacity - 1;
+  size_t start = (hash >> 7) & mask & ~(size_t)(KC_SET_GROUP_WIDTH - 1);
+
+  // visit the groups in triangular order, which covers the whole table
+  for (size_t step = 0; step <= mask / KC_SET_GROUP_WIDTH; ++step)
+  {
+    const int8_t* group = set->_control + start;
+
+    // compare only the slots with the same 7 bits of the hash
+    for (unsigned match = _group_match(group, (int8_t)(hash & 0x7F));
+         match != 0; match &= match - 1)
+    {
+      size_t candidate = start + (size_t)_lowest_bit(match);
+
+      if (set->_slots[candidate].hash == hash &&
+          set->_compare(&searchable, &set->_slots[candidate].pair) == 0)
+      {
+        (*index) = candidate;
+        return KC_SUCCESS;
+      }
+    }
+
+    // an empty slot ends the probe sequence
+    if (_group_match(group, KC_SET_CTRL_EMPTY) != 0)
     {
-      // return NULL if not found
-      value = NULL;
+      break;
     }
+
+    start = (start + (step + 1) * KC_SET_GROUP_WIDTH) & mask;
   }
-  else
+
+  return KC_INVALID;
+}
+
+//---------------------------------------------------------------------------//
+
+size_t _find_free_slot_hash_set(struct kc_set_t* set, size_t hash)
+{
+  size_t mask  = set->_capacity - 1;
+  size_t start = (hash >> 7) & mask & ~(size_t)(KC_SET_GROUP_WIDTH - 1);
+
+  // the table is never full, so there is always a free slot
+  for (size_t step = 0; ; ++step)
   {
-    // return NULL if not found
-    value = NULL;
+    unsigned match = _group_match_free(set->_control + start);
+
+    if (match != 0)
+    {
+      return start + (size_t)_lowest_bit(match);
+    }
+
+    start = (start + (step + 1) * KC_SET_GROUP_WIDTH) & mask;
   }
+}
 
-  return KC_SUCCESS;
+//---------------------------------------------------------------------------//
+
+unsigned _group_match(const int8_t* group, int8_t control)
+{
+#if defined(__SSE2__)
+  __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+  return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(control), ctrl));
+#else
+  unsigned match = 0;
+  for (int i = 0; i < KC_SET_GROUP_WIDTH; ++i)
+  {
+    match |= (unsigned)(group[i] == control) << i;
+  }
+  return match;
+#endif
 }
 
 //---------------------------------------------------------------------------//
 
-void _recursive_set_destroy(struct kc_node_t* node)
+unsigned _group_match_free(const int8_t* group)
 {
-  // chekc the previous node
-  if (node->prev != NULL)
+#if defined(__SSE2__)
+  // both the empty and deleted slots have the sign bit set
+  return (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+  unsigned match = 0;
+  for (int i = 0; i < KC_SET_GROUP_WIDTH; ++i)
   {
-    _recursive_set_destroy(node->prev);
+    match |= (unsigned)(group[i] < 0) << i;
   }
+  return match;
+#endif
+}
+
+//---------------------------------------------------------------------------//
 
-  // check the next node
-  if (node->next != NULL)
+size_t _hash_key_bytes(const void* key, size_t key_size)
+{
+  // FNV-1a over the bytes of the key
+  const unsigned char* bytes = key;
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (size_t i = 0; i < key_size; ++i)
   {
-    _recursive_set_destroy(node->next);
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
   }
 
-  // destroy the pair
-  pair_destructor(node->data);
+  // mix the high bits down, the low 7 bits are stored in the control bytes
+  hash ^= hash >> 32;
+
+  return (size_t)hash;
+}
+
+//---------------------------------------------------------------------------//
+
+int _lowest_bit(unsigned mask)
+{
+#if defined(__GNUC__)
+  return __builtin_ctz(mask);
+#else
+  int index = 0;
+  while ((mask & 1) == 0)
+  {
+    mask >>= 1;
+    ++index;
+  }
+  return index;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+
+int _rehash_set(struct kc_set_t* set, size_t new_capacity)
+{
+  int8_t*               new_control = malloc(new_capacity * sizeof(int8_t));
+  struct kc_set_slot_t* new_slots   = malloc(new_capacity * sizeof(struct kc_set_slot_t));
+
+  // confirm that there is memory to allocate
+  if (new_control == NULL || new_slots == NULL)
+  {
+    free(new_control);
+    free(new_slots);
+
+    return KC_OUT_OF_MEMORY;
+  }
+
+  memset(new_control, KC_SET_CTRL_EMPTY, new_capacity * sizeof(int8_t));
+
+  int8_t*               old_control  = set->_control;
+  struct kc_set_slot_t* old_slots    = set->_slots;
+  size_t                old_capacity = set->_capacity;
+
+  // keep 1/8 of the slots empty, so the probe sequences stay short
+  set->_control     = new_control;
+  set->_slots       = new_slots;
+  set->_capacity    = new_capacity;
+  set->_growth_left = new_capacity - new_capacity / 8 - set->_length;
+
+  // move the pairs using their stored hash, the keys are not hashed again
+  for (size_t i = 0; i < old_capacity; ++i)
+  {
+    if (old_control[i] >= 0)
+    {
+      size_t index = _find_free_slot_hash_set(set, old_slots[i].hash);
+
+      set->_control[index] = old_control[i];
+      set->_slots[index]   = old_slots[i];
+    }
+  }
+
+  free(old_control);
+  free(old_slots);
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int _search_node_set(struct kc_set_t* set, void* key, struct kc_node_t** node)
+{
+  // the compare function only looks at the keys, so the pair used for
+  // searching can live on the stack and point to the key of the caller
+  struct kc_pair_t searchable = { key, NULL };
+
+  return set->_entries->search(set->_entries, &searchable, node);
 }
 
 //---------------------------------------------------------------------------//
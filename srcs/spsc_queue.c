@@ -0,0 +1,238 @@
+// This file is part of keepcoding_core
+// ==================================
+//
+// spsc_queue.c
+//
+// Copyright (c) 2024 Daniel Tanase
+// SPDX-License-Identifier: MIT License
+
+#include "../../hdrs/datastructs/spsc_queue.h"
+#include "../../hdrs/common.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//--- MARK: PUBLIC FUNCTION PROTOTYPES --------------------------------------//
+
+static int get_length_spsc_queue  (struct kc_spsc_queue_t* self, size_t* length);
+static int pop_items_spsc_queue   (struct kc_spsc_queue_t* self, void* data, size_t count, size_t* popped);
+static int push_items_spsc_queue  (struct kc_spsc_queue_t* self, void* data, size_t count, size_t* pushed);
+
+//--- MARK: PRIVATE FUNCTION PROTOTYPES -------------------------------------//
+
+static void _copy_from_ring  (struct kc_spsc_queue_t* queue, size_t position, unsigned char* data, size_t count);
+static void _copy_to_ring    (struct kc_spsc_queue_t* queue, size_t position, const unsigned char* data, size_t count);
+
+//---------------------------------------------------------------------------//
+
+struct kc_spsc_queue_t* new_spsc_queue(size_t capacity, size_t elem_size)
+{
+  // confirm the capacity and the size of the items are at least one
+  if (capacity < 1 || elem_size < 1)
+  {
+    log_error(KC_UNDERFLOW_LOG);
+    return NULL;
+  }
+
+  // create a SPSC Queue instance to be returned, aligned to the cache line
+  size_t size = (sizeof(struct kc_spsc_queue_t) + KC_CACHE_LINE_SIZE - 1) /
+      KC_CACHE_LINE_SIZE * KC_CACHE_LINE_SIZE;
+
+  struct kc_spsc_queue_t* new_queue = aligned_alloc(KC_CACHE_LINE_SIZE, size);
+
+  // confirm that there is memory to allocate
+  if (new_queue == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return NULL;
+  }
+
+  new_queue->_logger = new_logger(KC_SPSC_QUEUE_LOG_PATH);
+
+  if (new_queue->_logger == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+
+    // free the queue instance
+    free(new_queue);
+
+    return NULL;
+  }
+
+  // round the capacity up to a power of two, so the positions wrap around
+  // the buffer with a mask and the counters can overflow safely
+  size_t new_capacity = 1;
+  while (new_capacity < capacity)
+  {
+    new_capacity *= 2;
+  }
+
+  new_queue->_buffer = malloc(new_capacity * elem_size);
+
+  // confirm that there is memory to allocate
+  if (new_queue->_buffer == NULL)
+  {
+    log_error(KC_OUT_OF_MEMORY_LOG);
+
+    // free the queue instances
+    destroy_logger(new_queue->_logger);
+    free(new_queue);
+
+    return NULL;
+  }
+
+  // initialize the structure members fields
+  atomic_init(&new_queue->_head, 0);
+  atomic_init(&new_queue->_tail, 0);
+
+  new_queue->_cached_head = 0;
+  new_queue->_cached_tail = 0;
+  new_queue->_capacity    = new_capacity;
+  new_queue->_elem_size   = elem_size;
+
+  // assigns the public member methods
+  new_queue->length = get_length_spsc_queue;
+  new_queue->pop    = pop_items_spsc_queue;
+  new_queue->push   = push_items_spsc_queue;
+
+  return new_queue;
+}
+
+//---------------------------------------------------------------------------//
+
+void destroy_spsc_queue(struct kc_spsc_queue_t* queue)
+{
+  // if the queue reference is NULL, do nothing
+  if (queue == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return;
+  }
+
+  destroy_logger(queue->_logger);
+
+  free(queue->_buffer);
+  free(queue);
+}
+
+//---------------------------------------------------------------------------//
+
+int get_length_spsc_queue(struct kc_spsc_queue_t* self, size_t* length)
+{
+  // if the queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // the other thread might move in the meantime, so this is only a snapshot
+  size_t head = atomic_load_explicit(&self->_head, memory_order_acquire);
+  size_t tail = atomic_load_explicit(&self->_tail, memory_order_acquire);
+
+  (*length) = tail - head;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int pop_items_spsc_queue(struct kc_spsc_queue_t* self, void* data, size_t count, size_t* popped)
+{
+  // if the queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // only the consumer writes the head
+  size_t head = atomic_load_explicit(&self->_head, memory_order_relaxed);
+
+  // read the tail of the producer only when the cached one isn't enough
+  if (self->_cached_tail - head < count)
+  {
+    self->_cached_tail = atomic_load_explicit(&self->_tail, memory_order_acquire);
+  }
+
+  size_t available = self->_cached_tail - head;
+  size_t items = count < available ? count : available;
+
+  _copy_from_ring(self, head, data, items);
+
+  // release the slots back to the producer
+  atomic_store_explicit(&self->_head, head + items, memory_order_release);
+
+  (*popped) = items;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int push_items_spsc_queue(struct kc_spsc_queue_t* self, void* data, size_t count, size_t* pushed)
+{
+  // if the queue reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // only the producer writes the tail
+  size_t tail = atomic_load_explicit(&self->_tail, memory_order_relaxed);
+
+  // read the head of the consumer only when the cached one isn't enough
+  if (self->_capacity - (tail - self->_cached_head) < count)
+  {
+    self->_cached_head = atomic_load_explicit(&self->_head, memory_order_acquire);
+  }
+
+  size_t available = self->_capacity - (tail - self->_cached_head);
+  size_t items = count < available ? count : available;
+
+  _copy_to_ring(self, tail, data, items);
+
+  // publish the items to the consumer
+  atomic_store_explicit(&self->_tail, tail + items, memory_order_release);
+
+  (*pushed) = items;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+void _copy_from_ring(struct kc_spsc_queue_t* queue, size_t position, unsigned char* data, size_t count)
+{
+  size_t index = position & (queue->_capacity - 1);
+  size_t first = queue->_capacity - index;
+
+  // the items might wrap around the end of the buffer
+  if (first > count)
+  {
+    first = count;
+  }
+
+  memcpy(data, queue->_buffer + index * queue->_elem_size, first * queue->_elem_size);
+  memcpy(data + first * queue->_elem_size, queue->_buffer, (count - first) * queue->_elem_size);
+}
+
+//---------------------------------------------------------------------------//
+
+void _copy_to_ring(struct kc_spsc_queue_t* queue, size_t position, const unsigned char* data, size_t count)
+{
+  size_t index = position & (queue->_capacity - 1);
+  size_t first = queue->_capacity - index;
+
+  // the items might wrap around the end of the buffer
+  if (first > count)
+  {
+    first = count;
+  }
+
+  memcpy(queue->_buffer + index * queue->_elem_size, data, first * queue->_elem_size);
+  memcpy(queue->_buffer, data + first * queue->_elem_size, (count - first) * queue->_elem_size);
+}
+
+//---------------------------------------------------------------------------//
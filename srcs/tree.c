@@ -15,15 +15,42 @@
 
 //--- MARK: PUBLIC FUNCTION PROTOTYPES --------------------------------------//
 
+static int first_node_btree       (struct kc_tree_t* self, struct kc_node_t** node);
 static int insert_new_node_btree  (struct kc_tree_t* self, void* data, size_t size);
+static int last_node_btree        (struct kc_tree_t* self, struct kc_node_t** node);
+static int length_btree           (struct kc_tree_t* self, size_t* length);
+static int lower_bound_btree      (struct kc_tree_t* self, void* data, struct kc_node_t** node);
+static int next_node_btree        (struct kc_tree_t* self, struct kc_node_t** node);
+static int prev_node_btree        (struct kc_tree_t* self, struct kc_node_t** node);
+static int range_btree            (struct kc_tree_t* self, void* low, void* high, int (*callback)(void* data, void* context), void* context);
+static int rank_btree             (struct kc_tree_t* self, void* data, size_t* rank);
 static int remove_node_btree      (struct kc_tree_t* self, void* data, size_t size);
 static int search_node_btree      (struct kc_tree_t* self, void* data, struct kc_node_t** node);
+static int select_node_btree      (struct kc_tree_t* self, size_t index, struct kc_node_t** node);
+static int upper_bound_btree      (struct kc_tree_t* self, void* data, struct kc_node_t** node);
+static int insert_new_node_rbtree (struct kc_tree_t* self, void* data, size_t size);
+static int remove_node_rbtree     (struct kc_tree_t* self, void* data, size_t size);
 
 //--- MARK: PRIVATE FUNCTION PROTOTYPES -------------------------------------//
 
-static struct kc_node_t* _insert_node_btree       (struct kc_tree_t* self, struct kc_node_t* node, void* data, size_t size);
-static void              _recursive_destroy_tree  (struct kc_node_t* node);
-static struct kc_node_t* _recursive_remove_node   (struct kc_tree_t* self, struct kc_node_t* root, void* data, size_t size);
+static struct kc_node_t* _build_sorted_nodes      (struct kc_tree_t* self, unsigned char* array, size_t elem_size, size_t low, size_t high, size_t depth, size_t red_depth, bool* failed);
+static void              _destroy_tree_nodes      (struct kc_tree_t* self);
+static int               _insert_node_btree       (struct kc_tree_t* self, void* data, size_t size, struct kc_node_t** node);
+static bool              _unlink_node             (struct kc_tree_t* self, struct kc_node_t* node, struct kc_node_t** child, struct kc_node_t** child_parent);
+
+static bool              _is_red                  (struct kc_node_t* node);
+static struct kc_node_t* _parent_of               (struct kc_node_t* node);
+static void              _rb_insert_fixup         (struct kc_tree_t* self, struct kc_node_t* node);
+static void              _rb_remove_fixup         (struct kc_tree_t* self, struct kc_node_t* node, struct kc_node_t* parent);
+static void              _replace_child           (struct kc_tree_t* self, struct kc_node_t* parent, struct kc_node_t* old_child, struct kc_node_t* new_child);
+static void              _rotate_left             (struct kc_tree_t* self, struct kc_node_t* node);
+static void              _rotate_right            (struct kc_tree_t* self, struct kc_node_t* node);
+static void              _set_parent              (struct kc_node_t* node, struct kc_node_t* parent);
+static void              _set_red                 (struct kc_node_t* node, bool red);
+static size_t            _subtree_count           (struct kc_node_t* node);
+static void              _update_count            (struct kc_node_t* node);
+static struct kc_node_t* _tree_node_constructor   (struct kc_tree_t* self, void* data, size_t size);
+static void              _transplant              (struct kc_tree_t* self, struct kc_node_t* old_node, struct kc_node_t* new_node);
 
 //---------------------------------------------------------------------------//
 
@@ -52,14 +79,122 @@ struct kc_tree_t* new_tree(int (*compare)(const void* a, const void* b))
     return NULL;
   }
 
+  // the nodes of the tree are allocated in chunks
+  new_tree->_pool = new_node_pool(sizeof(struct kc_tree_node_t));
+
+  if (new_tree->_pool == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+
+    // free the tree instances
+    destroy_logger(new_tree->_logger);
+    free(new_tree);
+
+    return NULL;
+  }
+
   // initialize the structure members fields
   new_tree->root = NULL;
 
   // assigns the public member methods
-  new_tree->compare = compare;
-  new_tree->insert  = insert_new_node_btree;
-  new_tree->remove  = remove_node_btree;
-  new_tree->search  = search_node_btree;
+  new_tree->compare     = compare;
+  new_tree->first       = first_node_btree;
+  new_tree->insert      = insert_new_node_btree;
+  new_tree->last        = last_node_btree;
+  new_tree->length      = length_btree;
+  new_tree->lower_bound = lower_bound_btree;
+  new_tree->next        = next_node_btree;
+  new_tree->prev        = prev_node_btree;
+  new_tree->range       = range_btree;
+  new_tree->rank        = rank_btree;
+  new_tree->remove      = remove_node_btree;
+  new_tree->search      = search_node_btree;
+  new_tree->select      = select_node_btree;
+  new_tree->upper_bound = upper_bound_btree;
+
+  return new_tree;
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_tree_t* new_rb_tree(int (*compare)(const void* a, const void* b))
+{
+  // the red-black tree is a regular Tree that keeps itself balanced
+  struct kc_tree_t* new_rb_tree = new_tree(compare);
+
+  if (new_rb_tree == NULL)
+  {
+    return NULL; /* an error has already been displayed */
+  }
+
+  // replace the insert and remove methods with the balanced ones
+  new_rb_tree->insert = insert_new_node_rbtree;
+  new_rb_tree->remove = remove_node_rbtree;
+
+  return new_rb_tree;
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_tree_t* new_tree_from_sorted(int (*compare)(const void* a, const void* b),
+    void* array, size_t count, size_t elem_size)
+{
+  if (array == NULL && count > 0)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return NULL;
+  }
+
+  if (elem_size < 1)
+  {
+    log_error(KC_UNDERFLOW_LOG);
+    return NULL;
+  }
+
+  struct kc_tree_t* new_tree = new_rb_tree(compare);
+
+  if (new_tree == NULL)
+  {
+    return NULL; /* an error has already been displayed */
+  }
+
+  // the items must be strictly increasing to form a valid tree
+  unsigned char* items = array;
+
+  for (size_t i = 1; i < count; ++i)
+  {
+    if (compare(items + (i - 1) * elem_size, items + i * elem_size) >= 0)
+    {
+      new_tree->_logger->log(new_tree->_logger, KC_WARNING_LOG, KC_INVALID,
+        __FILE__, __LINE__, __func__);
+
+      destroy_tree(new_tree);
+
+      return NULL;
+    }
+  }
+
+  // only the nodes of the last level are red, which keeps the same number
+  // of black nodes on every path, whether the last level is full or not
+  size_t red_depth = 0;
+  while (((size_t)2 << red_depth) <= count)
+  {
+    ++red_depth;
+  }
+
+  bool failed = false;
+  new_tree->root = _build_sorted_nodes(new_tree, items, elem_size, 0, count,
+    0, red_depth, &failed);
+
+  if (failed)
+  {
+    log_error(KC_OUT_OF_MEMORY_LOG);
+
+    // the nodes built so far are linked, so they are freed with the tree
+    destroy_tree(new_tree);
+
+    return NULL;
+  }
 
   return new_tree;
 }
@@ -75,19 +210,40 @@ void destroy_tree(struct kc_tree_t* tree)
     return;
   }
 
-  if (tree->root != NULL)
-  {
-    _recursive_destroy_tree(tree->root);
-  }
+  _destroy_tree_nodes(tree);
 
   destroy_logger(tree->_logger);
 
-  // free the binary tree too
+  // release all the nodes at once and free the binary tree too
+  destroy_node_pool(tree->_pool);
   free(tree);
 }
 
 //---------------------------------------------------------------------------//
 
+int first_node_btree(struct kc_tree_t* self, struct kc_node_t** node)
+{
+  // if the tree reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // the smallest node is the leftmost one
+  struct kc_node_t* current = self->root;
+  while (current != NULL && current->prev != NULL)
+  {
+    current = current->prev;
+  }
+
+  (*node) = current;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
 int insert_new_node_btree(struct kc_tree_t* self, void* data, size_t size)
 {
   // if the tree reference is NULL, do nothing
@@ -97,14 +253,40 @@ int insert_new_node_btree(struct kc_tree_t* self, void* data, size_t size)
     return KC_NULL_REFERENCE;
   }
 
-  self->root = _insert_node_btree(self, self->root, data, size);
+  struct kc_node_t* new_node = NULL;
+
+  return _insert_node_btree(self, data, size, &new_node);
+}
+
+//---------------------------------------------------------------------------//
+
+int insert_new_node_rbtree(struct kc_tree_t* self, void* data, size_t size)
+{
+  // if the tree reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  struct kc_node_t* new_node = NULL;
+  int ret = _insert_node_btree(self, data, size, &new_node);
+
+  // nothing to rebalance when the data was already in the tree
+  if (ret != KC_SUCCESS || new_node == NULL)
+  {
+    return ret;
+  }
+
+  // every new node is red and must be rebalanced from the bottom up
+  _rb_insert_fixup(self, new_node);
 
   return KC_SUCCESS;
 }
 
 //---------------------------------------------------------------------------//
 
-int remove_node_btree(struct kc_tree_t* self, void* data, size_t size)
+int last_node_btree(struct kc_tree_t* self, struct kc_node_t** node)
 {
   // if the tree reference is NULL, do nothing
   if (self == NULL)
@@ -113,14 +295,21 @@ int remove_node_btree(struct kc_tree_t* self, void* data, size_t size)
     return KC_NULL_REFERENCE;
   }
 
-  self->root = _recursive_remove_node(self, self->root, data, size);
+  // the greatest node is the rightmost one
+  struct kc_node_t* current = self->root;
+  while (current != NULL && current->next != NULL)
+  {
+    current = current->next;
+  }
+
+  (*node) = current;
 
   return KC_SUCCESS;
 }
 
 //---------------------------------------------------------------------------//
 
-int search_node_btree(struct kc_tree_t* self, void* data, struct kc_node_t** node)
+int length_btree(struct kc_tree_t* self, size_t* length)
 {
   // if the tree reference is NULL, do nothing
   if (self == NULL)
@@ -129,152 +318,899 @@ int search_node_btree(struct kc_tree_t* self, void* data, struct kc_node_t** nod
     return KC_NULL_REFERENCE;
   }
 
-  // start searching from the root of the tree
+  // the root counts every node of the tree
+  (*length) = _subtree_count(self->root);
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int lower_bound_btree(struct kc_tree_t* self, void* data, struct kc_node_t** node)
+{
+  // if the tree reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // remember the last node that is not smaller than the data, while
+  // looking for a smaller one on its left side
+  struct kc_node_t* bound   = NULL;
   struct kc_node_t* current = self->root;
 
   while (current != NULL)
   {
-    // check if the current node's data is greater (move to left)
-    if (self->compare(data, current->data) < 0)
+    if (self->compare(data, current->data) <= 0)
     {
+      bound = current;
       current = current->prev;
-
-      // check if the current node's data is smaller (move to right)
     }
-    else if (self->compare(data, current->data) > 0)
+    else
     {
       current = current->next;
-
-      // the desired node was found, return it
     }
-    else
-    {
-      (*node) = current;
+  }
 
-      return KC_SUCCESS;
+  (*node) = bound;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int next_node_btree(struct kc_tree_t* self, struct kc_node_t** node)
+{
+  // if the tree or the node reference is NULL, do nothing
+  if (self == NULL || node == NULL || (*node) == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  struct kc_node_t* current = (*node);
+
+  // the successor is the leftmost node of the right subtree
+  if (current->next != NULL)
+  {
+    current = current->next;
+    while (current->prev != NULL)
+    {
+      current = current->prev;
     }
+
+    (*node) = current;
+
+    return KC_SUCCESS;
   }
 
-  // if the node was not found, return NULL
-  (*node) = NULL;
+  // otherwise it is the first ancestor reached from its left side
+  struct kc_node_t* parent = _parent_of(current);
+  while (parent != NULL && parent->next == current)
+  {
+    current = parent;
+    parent = _parent_of(current);
+  }
+
+  (*node) = parent;
 
   return KC_SUCCESS;
 }
 
 //---------------------------------------------------------------------------//
 
-struct kc_node_t* _insert_node_btree(struct kc_tree_t* self,
-    struct kc_node_t* node, void* data, size_t size)
+int prev_node_btree(struct kc_tree_t* self, struct kc_node_t** node)
 {
-  // check if this is the first node in the tree
-  if (!node)
+  // if the tree or the node reference is NULL, do nothing
+  if (self == NULL || node == NULL || (*node) == NULL)
   {
-    node = node_constructor(data, size);
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
 
-  } // check if the current node's data is smaller (move to left)
-  else if (self->compare(data, node->data) < 0)
+  struct kc_node_t* current = (*node);
+
+  // the predecessor is the rightmost node of the left subtree
+  if (current->prev != NULL)
   {
-    node->prev = _insert_node_btree(self, node->prev, data, size);
+    current = current->prev;
+    while (current->next != NULL)
+    {
+      current = current->next;
+    }
+
+    (*node) = current;
+
+    return KC_SUCCESS;
+  }
 
-  } // check if the current node's data is greater (move to right)
-  else if (self->compare(data, node->data) > 0)
+  // otherwise it is the first ancestor reached from its right side
+  struct kc_node_t* parent = _parent_of(current);
+  while (parent != NULL && parent->prev == current)
   {
-    node->next = _insert_node_btree(self, node->next, data, size);
+    current = parent;
+    parent = _parent_of(current);
   }
 
-  return node;
+  (*node) = parent;
+
+  return KC_SUCCESS;
 }
 
 //---------------------------------------------------------------------------//
 
-void _recursive_destroy_tree(struct kc_node_t* node)
+int range_btree(struct kc_tree_t* self, void* low, void* high,
+    int (*callback)(void* data, void* context), void* context)
 {
-  // chekc the previous node
-  if (node->prev != NULL)
+  // if the tree or the callback reference is NULL, do nothing
+  if (self == NULL || callback == NULL)
   {
-    _recursive_destroy_tree(node->prev);
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
   }
 
-  // check the next node
-  if (node->next != NULL)
+  struct kc_node_t* node = NULL;
+  lower_bound_btree(self, low, &node);
+
+  // walk in order until the upper limit or until the callback stops it
+  while (node != NULL && self->compare(node->data, high) < 0)
   {
-    _recursive_destroy_tree(node->next);
+    if (callback(node->data, context) != 0)
+    {
+      break;
+    }
+
+    next_node_btree(self, &node);
   }
 
-  // destroy the node
-  node_destructor(node);
+  return KC_SUCCESS;
 }
 
 //---------------------------------------------------------------------------//
 
-struct kc_node_t* _recursive_remove_node(struct kc_tree_t* self, struct kc_node_t* root, void* data, size_t size)
+int rank_btree(struct kc_tree_t* self, void* data, size_t* rank)
 {
-  // base case
-  if (root == NULL)
+  // if the tree reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // every time the search moves right, the node and its left subtree
+  // are smaller than the data
+  size_t smaller = 0;
+  struct kc_node_t* current = self->root;
+
+  while (current != NULL)
   {
-    return root;
+    if (self->compare(data, current->data) <= 0)
+    {
+      current = current->prev;
+    }
+    else
+    {
+      smaller += _subtree_count(current->prev) + 1;
+      current = current->next;
+    }
   }
 
-  // recursive calls for ancestors of node to be removed
-  if (self->compare(data, root->data) < 0)
+  (*rank) = smaller;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int remove_node_btree(struct kc_tree_t* self, void* data, size_t size)
+{
+  // if the tree reference is NULL, do nothing
+  if (self == NULL)
   {
-    root->prev = _recursive_remove_node(self, root->prev, data, size);
-    return root;
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
   }
 
-  if (self->compare(data, root->data) > 0)
+  // find the node to be removed
+  struct kc_node_t* node = NULL;
+  search_node_btree(self, data, &node);
+
+  if (node != NULL)
   {
-    root->next = _recursive_remove_node(self, root->next, data, size);
-    return root;
+    struct kc_node_t* child        = NULL;
+    struct kc_node_t* child_parent = NULL;
+
+    _unlink_node(self, node, &child, &child_parent);
+    pooled_node_destructor(self->_pool, node);
   }
 
-  // we reach here when root is the node to be deleted
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
 
-  // case 1: node has no children or only one child
-  if (root->prev == NULL)
+int remove_node_rbtree(struct kc_tree_t* self, void* data, size_t size)
+{
+  // if the tree reference is NULL, do nothing
+  if (self == NULL)
   {
-    struct kc_node_t* next_node = root->next;
-    node_destructor(root);
-    return next_node;
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
   }
 
-  if (root->next == NULL)
+  // find the node to be removed
+  struct kc_node_t* node = NULL;
+  search_node_btree(self, data, &node);
+
+  if (node == NULL)
   {
-    struct kc_node_t* prev_node = root->prev;
-    node_destructor(root);
-    return prev_node;
+    return KC_SUCCESS;
   }
 
-  // case 2: node has two children
-  struct kc_node_t* succ_parent = root;
+  // the node that takes the removed position, and its parent (needed because
+  // the child might be NULL but the tree must still be fixed from there)
+  struct kc_node_t* child        = NULL;
+  struct kc_node_t* child_parent = NULL;
+
+  bool removed_red = _unlink_node(self, node, &child, &child_parent);
 
-  // find successor
-  struct kc_node_t* successor = root->next;
-  while (successor->prev != NULL)
+  pooled_node_destructor(self->_pool, node);
+
+  // removing a black node breaks the black height of the path
+  if (removed_red == false)
   {
-    succ_parent = successor;
-    successor = successor->prev;
+    _rb_remove_fixup(self, child, child_parent);
   }
 
-  // since successor is always the left child of its parent we can safely make
-  // successor's "next", the next child as "prev" of its parent. If there is no
-  // successor, then assign successor' "next" to succ_parent' "next"
-  if (succ_parent != root)
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int search_node_btree(struct kc_tree_t* self, void* data, struct kc_node_t** node)
+{
+  // if the tree reference is NULL, do nothing
+  if (self == NULL)
   {
-    succ_parent->prev = successor->prev;
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
   }
-  else
+
+  // start searching from the root of the tree
+  struct kc_node_t* current = self->root;
+
+  while (current != NULL)
   {
-    succ_parent->next = successor->next;
+    // compare only once per node, the comparison might be expensive
+    int cmp = self->compare(data, current->data);
+
+    // check if the current node's data is greater (move to left)
+    if (cmp < 0)
+    {
+      current = current->prev;
+
+      // check if the current node's data is smaller (move to right)
+    }
+    else if (cmp > 0)
+    {
+      current = current->next;
+
+      // the desired node was found, return it
+    }
+    else
+    {
+      (*node) = current;
+
+      return KC_SUCCESS;
+    }
   }
 
-  // copy successor data to root
-  memcpy(root->data, successor->data, size);
+  // if the node was not found, return NULL
+  (*node) = NULL;
+
+  return KC_SUCCESS;
+}
 
-  // delete successor and return root
-  node_destructor(successor);
+//---------------------------------------------------------------------------//
 
-  return root;
+int select_node_btree(struct kc_tree_t* self, size_t index, struct kc_node_t** node)
+{
+  // if the tree reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  if (index >= _subtree_count(self->root))
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INDEX_OUT_OF_BOUNDS,
+      __FILE__, __LINE__, __func__);
+
+    return KC_INDEX_OUT_OF_BOUNDS;
+  }
+
+  // skip whole left subtrees, using their counts to find the position
+  struct kc_node_t* current = self->root;
+
+  while (true)
+  {
+    size_t smaller = _subtree_count(current->prev);
+
+    if (index < smaller)
+    {
+      current = current->prev;
+    }
+    else if (index > smaller)
+    {
+      index  -= smaller + 1;
+      current = current->next;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  (*node) = current;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int upper_bound_btree(struct kc_tree_t* self, void* data, struct kc_node_t** node)
+{
+  // if the tree reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // remember the last node that is greater than the data, while
+  // looking for a smaller one on its left side
+  struct kc_node_t* bound   = NULL;
+  struct kc_node_t* current = self->root;
+
+  while (current != NULL)
+  {
+    if (self->compare(data, current->data) < 0)
+    {
+      bound = current;
+      current = current->prev;
+    }
+    else
+    {
+      current = current->next;
+    }
+  }
+
+  (*node) = bound;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_node_t* _build_sorted_nodes(struct kc_tree_t* self, unsigned char* array,
+    size_t elem_size, size_t low, size_t high, size_t depth, size_t red_depth, bool* failed)
+{
+  if (low >= high)
+  {
+    return NULL;
+  }
+
+  // the middle item is the root of the subtree, the nodes are created in
+  // order, so they end up next to each other in the pool
+  size_t mid = low + (high - low) / 2;
+
+  struct kc_node_t* prev = _build_sorted_nodes(self, array, elem_size, low, mid,
+    depth + 1, red_depth, failed);
+
+  if (*failed)
+  {
+    return prev;
+  }
+
+  struct kc_node_t* node = _tree_node_constructor(self, array + mid * elem_size, elem_size);
+
+  if (node == NULL)
+  {
+    (*failed) = true;
+    return prev;
+  }
+
+  _set_red(node, depth == red_depth && depth > 0);
+
+  node->prev = prev;
+  _set_parent(prev, node);
+
+  // even when the right side fails, whatever was built stays linked
+  node->next = _build_sorted_nodes(self, array, elem_size, mid + 1, high,
+    depth + 1, red_depth, failed);
+  _set_parent(node->next, node);
+
+  _update_count(node);
+
+  return node;
+}
+
+//---------------------------------------------------------------------------//
+
+void _destroy_tree_nodes(struct kc_tree_t* self)
+{
+  struct kc_node_t* node = self->root;
+
+  while (node != NULL)
+  {
+    // rotate the left children up until the node has none, so the whole
+    // tree is walked as a list without any recursion or stack
+    if (node->prev != NULL)
+    {
+      struct kc_node_t* prev = node->prev;
+      node->prev = prev->next;
+      prev->next = node;
+      node = prev;
+
+      continue;
+    }
+
+    // free the data, the node itself is released with the pool
+    struct kc_node_t* next = node->next;
+    pooled_node_free_data(self->_pool, node);
+    node = next;
+  }
+
+  self->root = NULL;
+}
+
+//---------------------------------------------------------------------------//
+
+int _insert_node_btree(struct kc_tree_t* self, void* data, size_t size, struct kc_node_t** node)
+{
+  // find the link where the new node should be attached
+  struct kc_node_t*  parent = NULL;
+  struct kc_node_t** link   = &self->root;
+
+  (*node) = NULL;
+
+  while ((*link) != NULL)
+  {
+    parent = (*link);
+
+    int cmp = self->compare(data, parent->data);
+
+    if (cmp < 0)
+    {
+      link = &parent->prev;
+    }
+    else if (cmp > 0)
+    {
+      link = &parent->next;
+    }
+    else
+    {
+      // the data is already in the tree
+      return KC_SUCCESS;
+    }
+  }
+
+  struct kc_node_t* new_node = _tree_node_constructor(self, data, size);
+
+  if (new_node == NULL)
+  {
+    self->_logger->log(self->_logger, KC_ERROR_LOG, KC_OUT_OF_MEMORY,
+        __FILE__, __LINE__, __func__);
+
+    return KC_OUT_OF_MEMORY;
+  }
+
+  _set_parent(new_node, parent);
+  (*link) = new_node;
+  (*node) = new_node;
+
+  // every ancestor has one more node in its subtree
+  for (; parent != NULL; parent = _parent_of(parent))
+  {
+    ++((struct kc_tree_node_t*)parent)->count;
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+bool _unlink_node(struct kc_tree_t* self, struct kc_node_t* node,
+    struct kc_node_t** child, struct kc_node_t** child_parent)
+{
+  bool removed_red = _is_red(node);
+
+  // the subtrees lose a node from where a node actually leaves its position
+  // (the node itself, or its successor when it has two children) up to root
+  struct kc_node_t* moved = node;
+
+  if (node->prev != NULL && node->next != NULL)
+  {
+    moved = node->next;
+    while (moved->prev != NULL)
+    {
+      moved = moved->prev;
+    }
+  }
+
+  for (struct kc_node_t* parent = _parent_of(moved); parent != NULL; parent = _parent_of(parent))
+  {
+    --((struct kc_tree_node_t*)parent)->count;
+  }
+
+  // case 1: node has no children or only one child
+  if (node->prev == NULL)
+  {
+    (*child) = node->next;
+    (*child_parent) = _parent_of(node);
+    _transplant(self, node, (*child));
+  }
+  else if (node->next == NULL)
+  {
+    (*child) = node->prev;
+    (*child_parent) = _parent_of(node);
+    _transplant(self, node, (*child));
+  }
+  else
+  {
+    // case 2: node has two children, relink the successor in its place
+    struct kc_node_t* successor = node->next;
+    while (successor->prev != NULL)
+    {
+      successor = successor->prev;
+    }
+
+    removed_red = _is_red(successor);
+    (*child) = successor->next;
+
+    if (_parent_of(successor) == node)
+    {
+      (*child_parent) = successor;
+    }
+    else
+    {
+      (*child_parent) = _parent_of(successor);
+      _transplant(self, successor, (*child));
+
+      successor->next = node->next;
+      _set_parent(successor->next, successor);
+    }
+
+    _transplant(self, node, successor);
+
+    successor->prev = node->prev;
+    _set_parent(successor->prev, successor);
+    _set_red(successor, _is_red(node));
+
+    ((struct kc_tree_node_t*)successor)->count = ((struct kc_tree_node_t*)node)->count;
+  }
+
+  // the color of the node that actually left its position
+  return removed_red;
+}
+
+//---------------------------------------------------------------------------//
+
+bool _is_red(struct kc_node_t* node)
+{
+  // NULL leaves are always black
+  return node != NULL && ((struct kc_tree_node_t*)node)->red;
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_node_t* _parent_of(struct kc_node_t* node)
+{
+  return node != NULL ? ((struct kc_tree_node_t*)node)->parent : NULL;
+}
+
+//---------------------------------------------------------------------------//
+
+void _rb_insert_fixup(struct kc_tree_t* self, struct kc_node_t* node)
+{
+  struct kc_node_t* parent = NULL;
+
+  // a red node can't have a red parent
+  while (_is_red(parent = _parent_of(node)))
+  {
+    // the parent is red, so it can't be the root and the grandparent exists
+    struct kc_node_t* grandparent = _parent_of(parent);
+
+    if (parent == grandparent->prev)
+    {
+      struct kc_node_t* uncle = grandparent->next;
+
+      // case 1: the uncle is red, recolor and move up the tree
+      if (_is_red(uncle))
+      {
+        _set_red(parent, false);
+        _set_red(uncle, false);
+        _set_red(grandparent, true);
+
+        node = grandparent;
+        continue;
+      }
+
+      // case 2: the node is an inner child, rotate it outside
+      if (node == parent->next)
+      {
+        _rotate_left(self, parent);
+
+        node = parent;
+        parent = _parent_of(node);
+      }
+
+      // case 3: the node is an outer child, rotate the grandparent
+      _set_red(parent, false);
+      _set_red(grandparent, true);
+      _rotate_right(self, grandparent);
+    }
+    else
+    {
+      struct kc_node_t* uncle = grandparent->prev;
+
+      // case 1: the uncle is red, recolor and move up the tree
+      if (_is_red(uncle))
+      {
+        _set_red(parent, false);
+        _set_red(uncle, false);
+        _set_red(grandparent, true);
+
+        node = grandparent;
+        continue;
+      }
+
+      // case 2: the node is an inner child, rotate it outside
+      if (node == parent->prev)
+      {
+        _rotate_right(self, parent);
+
+        node = parent;
+        parent = _parent_of(node);
+      }
+
+      // case 3: the node is an outer child, rotate the grandparent
+      _set_red(parent, false);
+      _set_red(grandparent, true);
+      _rotate_left(self, grandparent);
+    }
+  }
+
+  // the root is always black
+  _set_red(self->root, false);
+}
+
+//---------------------------------------------------------------------------//
+
+void _rb_remove_fixup(struct kc_tree_t* self, struct kc_node_t* node, struct kc_node_t* parent)
+{
+  // the node carries an extra black that must be pushed up or absorbed
+  while (node != self->root && _is_red(node) == false)
+  {
+    if (node == parent->prev)
+    {
+      struct kc_node_t* sibling = parent->next;
+
+      // case 1: the sibling is red, rotate to get a black sibling
+      if (_is_red(sibling))
+      {
+        _set_red(sibling, false);
+        _set_red(parent, true);
+        _rotate_left(self, parent);
+
+        sibling = parent->next;
+      }
+
+      // case 2: both nephews are black, recolor and move up the tree
+      if (_is_red(sibling->prev) == false && _is_red(sibling->next) == false)
+      {
+        _set_red(sibling, true);
+
+        node = parent;
+        parent = _parent_of(node);
+        continue;
+      }
+
+      // case 3: only the inner nephew is red, rotate it outside
+      if (_is_red(sibling->next) == false)
+      {
+        _set_red(sibling->prev, false);
+        _set_red(sibling, true);
+        _rotate_right(self, sibling);
+
+        sibling = parent->next;
+      }
+
+      // case 4: the outer nephew is red, rotate the parent and stop
+      _set_red(sibling, _is_red(parent));
+      _set_red(parent, false);
+      _set_red(sibling->next, false);
+      _rotate_left(self, parent);
+
+      node = self->root;
+    }
+    else
+    {
+      struct kc_node_t* sibling = parent->prev;
+
+      // case 1: the sibling is red, rotate to get a black sibling
+      if (_is_red(sibling))
+      {
+        _set_red(sibling, false);
+        _set_red(parent, true);
+        _rotate_right(self, parent);
+
+        sibling = parent->prev;
+      }
+
+      // case 2: both nephews are black, recolor and move up the tree
+      if (_is_red(sibling->prev) == false && _is_red(sibling->next) == false)
+      {
+        _set_red(sibling, true);
+
+        node = parent;
+        parent = _parent_of(node);
+        continue;
+      }
+
+      // case 3: only the inner nephew is red, rotate it outside
+      if (_is_red(sibling->prev) == false)
+      {
+        _set_red(sibling->next, false);
+        _set_red(sibling, true);
+        _rotate_left(self, sibling);
+
+        sibling = parent->prev;
+      }
+
+      // case 4: the outer nephew is red, rotate the parent and stop
+      _set_red(sibling, _is_red(parent));
+      _set_red(parent, false);
+      _set_red(sibling->prev, false);
+      _rotate_right(self, parent);
+
+      node = self->root;
+    }
+  }
+
+  _set_red(node, false);
+}
+
+//---------------------------------------------------------------------------//
+
+void _replace_child(struct kc_tree_t* self, struct kc_node_t* parent,
+    struct kc_node_t* old_child, struct kc_node_t* new_child)
+{
+  if (parent == NULL)
+  {
+    self->root = new_child;
+  }
+  else if (parent->prev == old_child)
+  {
+    parent->prev = new_child;
+  }
+  else
+  {
+    parent->next = new_child;
+  }
+}
+
+//---------------------------------------------------------------------------//
+
+void _rotate_left(struct kc_tree_t* self, struct kc_node_t* node)
+{
+  struct kc_node_t* pivot = node->next;
+
+  // the left subtree of the pivot becomes the right subtree of the node
+  node->next = pivot->prev;
+  _set_parent(node->next, node);
+
+  // the pivot takes the place of the node
+  _replace_child(self, _parent_of(node), node, pivot);
+  _set_parent(pivot, _parent_of(node));
+
+  pivot->prev = node;
+  _set_parent(node, pivot);
+
+  // the pivot takes the count of the node, which counts its new children
+  ((struct kc_tree_node_t*)pivot)->count = ((struct kc_tree_node_t*)node)->count;
+  _update_count(node);
+}
+
+//---------------------------------------------------------------------------//
+
+void _rotate_right(struct kc_tree_t* self, struct kc_node_t* node)
+{
+  struct kc_node_t* pivot = node->prev;
+
+  // the right subtree of the pivot becomes the left subtree of the node
+  node->prev = pivot->next;
+  _set_parent(node->prev, node);
+
+  // the pivot takes the place of the node
+  _replace_child(self, _parent_of(node), node, pivot);
+  _set_parent(pivot, _parent_of(node));
+
+  pivot->next = node;
+  _set_parent(node, pivot);
+
+  // the pivot takes the count of the node, which counts its new children
+  ((struct kc_tree_node_t*)pivot)->count = ((struct kc_tree_node_t*)node)->count;
+  _update_count(node);
+}
+
+//---------------------------------------------------------------------------//
+
+void _set_parent(struct kc_node_t* node, struct kc_node_t* parent)
+{
+  if (node != NULL)
+  {
+    ((struct kc_tree_node_t*)node)->parent = parent;
+  }
+}
+
+//---------------------------------------------------------------------------//
+
+void _set_red(struct kc_node_t* node, bool red)
+{
+  if (node != NULL)
+  {
+    ((struct kc_tree_node_t*)node)->red = red;
+  }
+}
+
+//---------------------------------------------------------------------------//
+
+size_t _subtree_count(struct kc_node_t* node)
+{
+  // NULL leaves count no nodes
+  return node != NULL ? ((struct kc_tree_node_t*)node)->count : 0;
+}
+
+//---------------------------------------------------------------------------//
+
+struct kc_node_t* _tree_node_constructor(struct kc_tree_t* self, void* data, size_t size)
+{
+  // the tree node starts with a regular node, so it can be taken from the
+  // pool and handed out to the users as a regular node
+  struct kc_node_t* new_node = pooled_node_constructor(self->_pool, data, size);
+
+  if (new_node == NULL)
+  {
+    return NULL; /* an error has already been displayed */
+  }
+
+  // new nodes are always red leaves
+  ((struct kc_tree_node_t*)new_node)->parent = NULL;
+  ((struct kc_tree_node_t*)new_node)->count  = 1;
+  ((struct kc_tree_node_t*)new_node)->red    = true;
+
+  return new_node;
+}
+
+//---------------------------------------------------------------------------//
+
+void _transplant(struct kc_tree_t* self, struct kc_node_t* old_node, struct kc_node_t* new_node)
+{
+  // replace the subtree rooted at the old node with the new one
+  _replace_child(self, _parent_of(old_node), old_node, new_node);
+  _set_parent(new_node, _parent_of(old_node));
+}
+
+//---------------------------------------------------------------------------//
+
+void _update_count(struct kc_node_t* node)
+{
+  // a node counts itself and both of its subtrees
+  ((struct kc_tree_node_t*)node)->count =
+    _subtree_count(node->prev) + _subtree_count(node->next) + 1;
 }
 
 //---------------------------------------------------------------------------//
@@ -12,11 +12,20 @@
 #include <stdlib.h>
 #include <string.h>
 
+// the value searched by "remove", passed to its predicate
+struct _value_match
+{
+  void* value;
+  int (*compare)(const void* a, const void* b);
+};
+
 //--- MARK: PUBLIC FUNCTION PROTOTYPES --------------------------------------//
 
+static int append_elems            (struct kc_vector_t* self, void* data, size_t count, size_t elem_size);
 static int erase_all_elems         (struct kc_vector_t* self);
 static int erase_elem              (struct kc_vector_t* self, int index);
 static int erase_elems_by_value    (struct kc_vector_t* self, void* value, int (*compare)(const void* a, const void* b));
+static int erase_elems_if          (struct kc_vector_t* self, bool (*predicate)(const void* elem, void* context), void* context);
 static int erase_first_elem        (struct kc_vector_t* self);
 static int erase_last_elem         (struct kc_vector_t* self);
 static int get_elem                (struct kc_vector_t* self, int index, void** at);
@@ -27,14 +36,29 @@ static int insert_at_beginning     (struct kc_vector_t* self, void* data, size_t
 static int insert_at_end           (struct kc_vector_t* self, void* data, size_t size);
 static int is_vector_empty         (struct kc_vector_t* self, bool* empty);
 static int insert_new_elem         (struct kc_vector_t* self, int index, void* data, size_t size);
+static int insert_new_elems        (struct kc_vector_t* self, int index, void* data, size_t count, size_t elem_size);
+static int reserve_capacity        (struct kc_vector_t* self, size_t capacity);
 static int resize_vector_capacity  (struct kc_vector_t* self, size_t new_capacity);
 static int search_elem             (struct kc_vector_t* self, void* value, int (*compare)(const void* a, const void* b), bool* exists);
+static int set_growth_factor       (struct kc_vector_t* self, double factor);
+static int shrink_capacity         (struct kc_vector_t* self);
 
 //--- MARK: PRIVATE FUNCTION PROTOTYPES -------------------------------------//
 
-static void _permute_to_left   (struct kc_vector_t* vector, int start, int end);
-static void _permute_to_right  (struct kc_vector_t* vector, int start, int end);
-static void _resize_vector     (struct kc_vector_t* vector, size_t new_capacity);
+static char*  _buffer_of         (struct kc_vector_t* vector);
+static void   _close_gap         (struct kc_vector_t* vector);
+static void*  _elem_at           (struct kc_vector_t* vector, size_t index);
+static bool   _equals_value      (const void* elem, void* context);
+static void   _free_elems        (struct kc_vector_t* vector, size_t start, size_t end);
+static size_t _grown_capacity    (struct kc_vector_t* vector);
+static bool   _is_small          (struct kc_vector_t* vector);
+static int    _open_gap          (struct kc_vector_t* vector);
+static void   _permute_to_left   (struct kc_vector_t* vector, int start, int end);
+static void   _permute_to_right  (struct kc_vector_t* vector, int start, int end);
+static char*  _reallocate_buffer (struct kc_vector_t* vector, size_t new_capacity);
+static void   _release_capacity  (struct kc_vector_t* vector);
+static void   _resize_vector     (struct kc_vector_t* vector, size_t new_capacity);
+static size_t _slot_size         (struct kc_vector_t* vector);
 
 //---------------------------------------------------------------------------//
 
@@ -59,42 +83,79 @@ struct kc_vector_t* new_vector()
     return NULL;
   }
 
-  // initialize the structure members fields
-  new_vector->_capacity = 16;
-  new_vector->length    = 0;
-  new_vector->data      = malloc(16 * sizeof(void*));
+  // initialize the structure members fields, the elements are stored in
+  // the small buffer of the struct until they outgrow it
+  new_vector->_capacity  = KC_VECTOR_SMALL_CAPACITY;
+  new_vector->_elem_size = 0;
+  new_vector->_front     = 0;
+  new_vector->_growth    = 2.0;
+  new_vector->length     = 0;
+  new_vector->data       = new_vector->_small;
 
-  // confirm that there is memory to allocate
-  if (new_vector->data == NULL)
-  {
-    log_error(KC_NULL_REFERENCE_LOG);
+  // assigns the public member methods
+  new_vector->append_n      = append_elems;
+  new_vector->at            = get_elem;
+  new_vector->back          = get_last_elem;
+  new_vector->clear         = erase_all_elems;
+  new_vector->empty         = is_vector_empty;
+  new_vector->erase         = erase_elem;
+  new_vector->front         = get_first_elem;
+  new_vector->insert        = insert_new_elem;
+  new_vector->insert_range  = insert_new_elems;
+  new_vector->max_size      = get_vector_capacity;
+  new_vector->pop_back      = erase_last_elem;
+  new_vector->pop_front     = erase_first_elem;
+  new_vector->push_back     = insert_at_end;
+  new_vector->push_front    = insert_at_beginning;
+  new_vector->remove        = erase_elems_by_value;
+  new_vector->remove_if     = erase_elems_if;
+  new_vector->reserve       = reserve_capacity;
+  new_vector->resize        = resize_vector_capacity;
+  new_vector->search        = search_elem;
+  new_vector->set_growth    = set_growth_factor;
+  new_vector->shrink_to_fit = shrink_capacity;
 
-    // free the instances and exit
-    free(new_vector->_logger);
-    free(new_vector->data);
-    free(new_vector);
+  return new_vector;
+}
+
+//---------------------------------------------------------------------------//
 
+struct kc_vector_t* new_vector_of(size_t elem_size)
+{
+  // confirm the size of the elements is at least one
+  if (elem_size < 1)
+  {
+    log_error(KC_UNDERFLOW_LOG);
     return NULL;
   }
 
-  // assigns the public member methods
-  new_vector->at         = get_elem;
-  new_vector->back       = get_last_elem;
-  new_vector->clear      = erase_all_elems;
-  new_vector->empty      = is_vector_empty;
-  new_vector->erase      = erase_elem;
-  new_vector->front      = get_first_elem;
-  new_vector->insert     = insert_new_elem;
-  new_vector->max_size   = get_vector_capacity;
-  new_vector->pop_back   = erase_last_elem;
-  new_vector->pop_front  = erase_first_elem;
-  new_vector->push_back  = insert_at_end;
-  new_vector->push_front = insert_at_beginning;
-  new_vector->remove     = erase_elems_by_value;
-  new_vector->resize     = resize_vector_capacity;
-  new_vector->search     = search_elem;
+  // the inline vector is a regular Vector that stores the elements itself
+  struct kc_vector_t* new_vector_of = new_vector();
 
-  return new_vector;
+  if (new_vector_of == NULL)
+  {
+    return NULL; /* an error has already been displayed */
+  }
+
+  // large elements don't fit the small buffer of the struct
+  if (new_vector_of->_capacity * elem_size > sizeof(new_vector_of->_small))
+  {
+    void** new_data = malloc(new_vector_of->_capacity * elem_size);
+
+    // confirm that there is memory to allocate
+    if (new_data == NULL)
+    {
+      log_error(KC_OUT_OF_MEMORY_LOG);
+      destroy_vector(new_vector_of);
+      return NULL;
+    }
+
+    new_vector_of->data = new_data;
+  }
+
+  new_vector_of->_elem_size = elem_size;
+
+  return new_vector_of;
 }
 
 //---------------------------------------------------------------------------//
@@ -113,21 +174,34 @@ void destroy_vector(struct kc_vector_t* vector)
   // free the memory for each element and the array itself
   if (vector->data != NULL)
   {
-    for (int i = 0; i < vector->length; ++i)
-    {
-      if (vector->data[i] != NULL)
-      {
-        free(vector->data[i]);
-      }
-    }
+    _free_elems(vector, 0, vector->length);
+  }
+
+  // the small buffer is freed along with the struct
+  if (!_is_small(vector))
+  {
+    free(_buffer_of(vector));
   }
 
-  free(vector->data);
   free(vector);
 }
 
 //---------------------------------------------------------------------------//
 
+int append_elems(struct kc_vector_t* self, void* data, size_t count, size_t elem_size)
+{
+  // if the vector reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  return insert_new_elems(self, (int)self->length, data, count, elem_size);
+}
+
+//---------------------------------------------------------------------------//
+
 int erase_all_elems(struct kc_vector_t* self)
 {
   // if the vector reference is NULL, do nothing
@@ -140,24 +214,19 @@ int erase_all_elems(struct kc_vector_t* self)
   // free the memory for each element
   if (self->data != NULL)
   {
-    for (int i = 0; i < self->length; ++i)
-    {
-      if (self->data[i] != NULL)
-      {
-        free(self->data[i]);
-      }
-    }
+    _free_elems(self, 0, self->length);
   }
 
-  // reallocate the default capacity
-  if (self->_capacity > 16)
+  // reset the length and the gap in front of the elements
+  self->length = 0;
+  _close_gap(self);
+
+  // go back to the default capacity, stored in the struct itself
+  if (self->_capacity > KC_VECTOR_SMALL_CAPACITY)
   {
-    _resize_vector(self, 16);
+    _resize_vector(self, KC_VECTOR_SMALL_CAPACITY);
   }
 
-  // reset the length
-  self->length = 0;
-
   return KC_SUCCESS;
 }
 
@@ -191,15 +260,23 @@ int erase_elem(struct kc_vector_t* self, int index)
   }
 
   // free the memory from the desired position
-  _permute_to_left(self, index, (int)self->length);
-  --self->length;
+  _free_elems(self, (size_t)index, (size_t)index + 1);
 
-  // resize if the length of the vector is less than half
-  if (self->length < self->_capacity / 2 && self->_capacity > 16)
+  // the first element only leaves a gap in front of the others
+  if (index == 0)
   {
-    _resize_vector(self, self->_capacity / 2);
+    self->data = (void**)((char*)self->data + _slot_size(self));
+    ++self->_front;
+  }
+  else
+  {
+    _permute_to_left(self, index, (int)self->length);
   }
 
+  --self->length;
+
+  _release_capacity(self);
+
   return KC_SUCCESS;
 }
 
@@ -215,23 +292,50 @@ int erase_elems_by_value(struct kc_vector_t* self, void* value,
     return KC_NULL_REFERENCE;
   }
 
-  // go through the array and check each element
-  int index = 0;
-  while (index < self->length)
+  // the value and the comparison are passed along to the predicate
+  struct _value_match match = { value, compare };
+
+  return erase_elems_if(self, _equals_value, &match);
+}
+
+//---------------------------------------------------------------------------//
+
+int erase_elems_if(struct kc_vector_t* self,
+    bool (*predicate)(const void* elem, void* context), void* context)
+{
+  // if the vector reference is NULL, do nothing
+  if (self == NULL || predicate == NULL)
   {
-    if (compare(self->data[index], value) == 0)
-    {
-      int ret = erase_elem(self, index);
-      if (ret != KC_SUCCESS)
-      {
-        return ret;
-      }
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
 
+  size_t slot = _slot_size(self);
+  char*  base = (char*)self->data;
+  size_t kept = 0;
+
+  // free the matching elements and slide the others over them, keeping
+  // their order, in a single pass
+  for (size_t i = 0; i < self->length; ++i)
+  {
+    if (predicate(_elem_at(self, i), context))
+    {
+      _free_elems(self, i, i + 1);
       continue;
     }
-    ++index;
+
+    if (kept != i)
+    {
+      memcpy(base + kept * slot, base + i * slot, slot);
+    }
+
+    ++kept;
   }
 
+  self->length = kept;
+
+  _release_capacity(self);
+
   return KC_SUCCESS;
 }
 
@@ -310,7 +414,7 @@ int get_elem(struct kc_vector_t* self, int index, void** at)
     return KC_INDEX_OUT_OF_BOUNDS;
   }
 
-  (*at) = self->data[index];
+  (*at) = _elem_at(self, (size_t)index);
 
   return KC_SUCCESS;
 }
@@ -464,28 +568,77 @@ int insert_new_elem(struct kc_vector_t* self, int index, void* data, size_t size
     return KC_INDEX_OUT_OF_BOUNDS;
   }
 
-  // reallocate more memory if the capacity is full
-  if (self->length + 1 >= self->_capacity)
+  // the inline elements must all have the same size
+  if (self->_elem_size != 0 && size != self->_elem_size)
   {
-    _resize_vector(self, self->_capacity * 2);
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INVALID,
+        __FILE__, __LINE__, __func__);
+
+    return KC_INVALID;
   }
 
-  // alocate space in memory
-  void* new_elem = malloc(size);
+  // alocate space in memory for the elements that are not stored inline
+  void* new_elem = NULL;
 
-  // check if the memory allocation was succesfull
-  if (new_elem == NULL)
+  if (self->_elem_size == 0)
   {
-    self->_logger->log(self->_logger, KC_ERROR_LOG, KC_OUT_OF_MEMORY,
-        __FILE__, __LINE__, __func__);
+    new_elem = malloc(size);
 
-    return KC_OUT_OF_MEMORY;
+    // check if the memory allocation was succesfull
+    if (new_elem == NULL)
+    {
+      self->_logger->log(self->_logger, KC_ERROR_LOG, KC_OUT_OF_MEMORY,
+          __FILE__, __LINE__, __func__);
+
+      return KC_OUT_OF_MEMORY;
+    }
+
+    memcpy(new_elem, data, size);
+  }
+
+  // a new first element takes a slot from the gap in front of the others,
+  // so they don't have to move
+  if (index == 0 && self->length > 0)
+  {
+    if (self->_front == 0 && _open_gap(self) != KC_SUCCESS)
+    {
+      free(new_elem);
+      return KC_OUT_OF_MEMORY; /* an error has already been displayed */
+    }
+
+    self->data = (void**)((char*)self->data - _slot_size(self));
+    --self->_front;
+  }
+  else
+  {
+    // reuse the gap left by the removed first elements once it is as
+    // big as the elements, otherwise reallocate more memory if the
+    // capacity is full
+    if (self->_front + self->length + 1 >= self->_capacity &&
+        self->_front >= self->length)
+    {
+      _close_gap(self);
+    }
+
+    if (self->_front + self->length + 1 >= self->_capacity)
+    {
+      _resize_vector(self, _grown_capacity(self));
+    }
+
+    _permute_to_right(self, index, (int)(self->length));
+  }
+
+  // insert the value at the specified location, the inline elements are
+  // copied straight into the buffer
+  if (self->_elem_size != 0)
+  {
+    memcpy(_elem_at(self, (size_t)index), data, size);
+  }
+  else
+  {
+    self->data[index] = new_elem;
   }
 
-  // insert the value at the specified location
-  memcpy(new_elem, data, size);
-  _permute_to_right(self, index, (int)(self->length));
-  self->data[index] = new_elem;
   ++self->length;
 
   return KC_SUCCESS;
@@ -493,6 +646,131 @@ int insert_new_elem(struct kc_vector_t* self, int index, void* data, size_t size
 
 //---------------------------------------------------------------------------//
 
+int insert_new_elems(struct kc_vector_t* self, int index, void* data,
+    size_t count, size_t elem_size)
+{
+  // if the vector reference is NULL, do nothing
+  if (self == NULL || data == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // confirm the user has specified a valid index
+  if (index < 0 || index > self->length)
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INDEX_OUT_OF_BOUNDS,
+        __FILE__, __LINE__, __func__);
+
+    return KC_INDEX_OUT_OF_BOUNDS;
+  }
+
+  // every element needs at least one byte, and the inline elements must
+  // all have the same size
+  if (elem_size < 1 || (self->_elem_size != 0 && elem_size != self->_elem_size))
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INVALID,
+        __FILE__, __LINE__, __func__);
+
+    return KC_INVALID;
+  }
+
+  if (count == 0)
+  {
+    return KC_SUCCESS;
+  }
+
+  // make room for all the elements at once (keeping a free slot, as the
+  // single insertion does), growing at least by the growth factor
+  if (self->_front + self->length + count >= self->_capacity)
+  {
+    size_t new_capacity = _grown_capacity(self);
+
+    if (new_capacity <= self->length + count)
+    {
+      new_capacity = self->length + count + 1;
+    }
+
+    _resize_vector(self, new_capacity);
+
+    if (self->_capacity != new_capacity)
+    {
+      return KC_OUT_OF_MEMORY; /* an error has already been displayed */
+    }
+  }
+
+  // move the following elements only once
+  size_t slot = _slot_size(self);
+  char*  base = (char*)self->data;
+
+  memmove(base + ((size_t)index + count) * slot, base + (size_t)index * slot,
+      (self->length - (size_t)index) * slot);
+
+  // the inline elements are copied straight into the buffer
+  if (self->_elem_size != 0)
+  {
+    memcpy(base + (size_t)index * slot, data, count * elem_size);
+    self->length += count;
+
+    return KC_SUCCESS;
+  }
+
+  // otherwise, every element gets its own block of memory
+  for (size_t i = 0; i < count; ++i)
+  {
+    void* new_elem = malloc(elem_size);
+
+    // on failure, undo the insertion of the previous elements
+    if (new_elem == NULL)
+    {
+      self->_logger->log(self->_logger, KC_ERROR_LOG, KC_OUT_OF_MEMORY,
+          __FILE__, __LINE__, __func__);
+
+      _free_elems(self, (size_t)index, (size_t)index + i);
+      memmove(base + (size_t)index * slot, base + ((size_t)index + count) * slot,
+          (self->length - (size_t)index) * slot);
+
+      return KC_OUT_OF_MEMORY;
+    }
+
+    memcpy(new_elem, (char*)data + i * elem_size, elem_size);
+    self->data[(size_t)index + i] = new_elem;
+  }
+
+  self->length += count;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int reserve_capacity(struct kc_vector_t* self, size_t capacity)
+{
+  // if the vector reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // the capacity is never reduced
+  if (capacity <= self->_capacity)
+  {
+    return KC_SUCCESS;
+  }
+
+  _resize_vector(self, capacity);
+
+  if (self->_capacity != capacity)
+  {
+    return KC_OUT_OF_MEMORY; /* an error has already been displayed */
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
 int resize_vector_capacity(struct kc_vector_t* self, size_t new_capacity)
 {
   // if the vector reference is NULL, do nothing
@@ -522,7 +800,7 @@ int search_elem(struct kc_vector_t* self, void* value,
   // go through the array and return true if found
   for (int i = 0; i < self->length; ++i)
   {
-    if (compare(self->data[i], value) == 0)
+    if (compare(_elem_at(self, (size_t)i), value) == 0)
     {
       (*exists) = true;
 
@@ -537,21 +815,268 @@ int search_elem(struct kc_vector_t* self, void* value,
 
 //---------------------------------------------------------------------------//
 
+int set_growth_factor(struct kc_vector_t* self, double factor)
+{
+  // if the vector reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // the capacity must grow every time it is full
+  if (!(factor > 1.0))
+  {
+    self->_logger->log(self->_logger, KC_WARNING_LOG, KC_INVALID,
+        __FILE__, __LINE__, __func__);
+
+    return KC_INVALID;
+  }
+
+  self->_growth = factor;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+int shrink_capacity(struct kc_vector_t* self)
+{
+  // if the vector reference is NULL, do nothing
+  if (self == NULL)
+  {
+    log_error(KC_NULL_REFERENCE_LOG);
+    return KC_NULL_REFERENCE;
+  }
+
+  // release the gap at the front and the unused slots at the back
+  size_t capacity = self->length > 0 ? self->length : 1;
+
+  if (capacity == self->_capacity)
+  {
+    return KC_SUCCESS;
+  }
+
+  _resize_vector(self, capacity);
+
+  if (self->_capacity != capacity)
+  {
+    return KC_OUT_OF_MEMORY; /* an error has already been displayed */
+  }
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
+char* _buffer_of(struct kc_vector_t* vector)
+{
+  // the buffer starts with the gap left in front of the elements
+  return (char*)vector->data - vector->_front * _slot_size(vector);
+}
+
+//---------------------------------------------------------------------------//
+
+void _close_gap(struct kc_vector_t* vector)
+{
+  if (vector->_front == 0)
+  {
+    return;
+  }
+
+  // move the elements back to the start of the buffer
+  char* buffer = _buffer_of(vector);
+
+  memmove(buffer, vector->data, vector->length * _slot_size(vector));
+
+  vector->data = (void**)buffer;
+  vector->_front = 0;
+}
+
+//---------------------------------------------------------------------------//
+
+void* _elem_at(struct kc_vector_t* vector, size_t index)
+{
+  // the inline elements are stored one after another in the buffer
+  if (vector->_elem_size != 0)
+  {
+    return (char*)vector->data + index * vector->_elem_size;
+  }
+
+  return vector->data[index];
+}
+
+//---------------------------------------------------------------------------//
+
+bool _equals_value(const void* elem, void* context)
+{
+  struct _value_match* match = context;
+
+  return match->compare(elem, match->value) == 0;
+}
+
+//---------------------------------------------------------------------------//
+
+void _free_elems(struct kc_vector_t* vector, size_t start, size_t end)
+{
+  // the inline elements are owned by the buffer
+  if (vector->_elem_size != 0)
+  {
+    return;
+  }
+
+  for (size_t i = start; i < end; ++i)
+  {
+    if (vector->data[i] != NULL)
+    {
+      free(vector->data[i]);
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+
+size_t _grown_capacity(struct kc_vector_t* vector)
+{
+  size_t capacity = (size_t)((double)vector->_capacity * vector->_growth);
+
+  // a small factor must still add at least one slot
+  return capacity > vector->_capacity ? capacity : vector->_capacity + 1;
+}
+
+//---------------------------------------------------------------------------//
+
+bool _is_small(struct kc_vector_t* vector)
+{
+  return _buffer_of(vector) == (char*)vector->_small;
+}
+
+//---------------------------------------------------------------------------//
+
+int _open_gap(struct kc_vector_t* vector)
+{
+  // the gap is as big as the elements, so it is only opened again after
+  // as many elements are pushed to the front
+  size_t gap  = vector->length > KC_VECTOR_SMALL_CAPACITY ?
+    vector->length : KC_VECTOR_SMALL_CAPACITY;
+  size_t slot = _slot_size(vector);
+
+  char* new_buffer = _reallocate_buffer(vector, vector->_capacity + gap);
+
+  // check if the memory reallocation was succesfull
+  if (new_buffer == NULL)
+  {
+    vector->_logger->log(vector->_logger, KC_ERROR_LOG, KC_OUT_OF_MEMORY,
+        __FILE__, __LINE__, __func__);
+
+    return KC_OUT_OF_MEMORY;
+  }
+
+  // move the elements after the gap
+  char* elems = new_buffer + vector->_front * slot;
+  memmove(elems + gap * slot, elems, vector->length * slot);
+
+  vector->data = (void**)(elems + gap * slot);
+  vector->_front += gap;
+  vector->_capacity += gap;
+
+  return KC_SUCCESS;
+}
+
+//---------------------------------------------------------------------------//
+
 void _permute_to_left(struct kc_vector_t* vector, int start, int end)
 {
-  for (int i = start; i < end && i < vector->length; ++i)
+  if (start + 1 >= end)
   {
-    vector->data[i] = vector->data[i + 1];
+    return;
   }
+
+  // move the slots after the start one position to the left
+  size_t slot = _slot_size(vector);
+  char*  base = (char*)vector->data;
+
+  memmove(base + (size_t)start * slot, base + (size_t)(start + 1) * slot,
+      (size_t)(end - start - 1) * slot);
 }
 
 //---------------------------------------------------------------------------//
 
 void _permute_to_right(struct kc_vector_t* vector, int start, int end)
 {
-  for (int i = end; i >= start && i > 0; --i)
+  if (start >= end)
+  {
+    return;
+  }
+
+  // move the slots from the start one position to the right
+  size_t slot = _slot_size(vector);
+  char*  base = (char*)vector->data;
+
+  memmove(base + (size_t)(start + 1) * slot, base + (size_t)start * slot,
+      (size_t)(end - start) * slot);
+}
+
+//---------------------------------------------------------------------------//
+
+char* _reallocate_buffer(struct kc_vector_t* vector, size_t new_capacity)
+{
+  size_t slot   = _slot_size(vector);
+  char*  buffer = _buffer_of(vector);
+  bool   fits   = new_capacity * slot <= sizeof(vector->_small);
+
+  // a heap buffer that stays on the heap is simply reallocated
+  if (!_is_small(vector) && !fits)
+  {
+    return realloc(buffer, new_capacity * slot);
+  }
+
+  // the small buffer already has room for the new capacity
+  if (_is_small(vector) && fits)
+  {
+    return buffer;
+  }
+
+  // otherwise, the slots move between the struct and the heap
+  char* new_buffer = fits ? (char*)vector->_small : malloc(new_capacity * slot);
+
+  if (new_buffer == NULL)
+  {
+    return NULL;
+  }
+
+  size_t kept = new_capacity < vector->_capacity ? new_capacity : vector->_capacity;
+  memcpy(new_buffer, buffer, kept * slot);
+
+  if (fits)
+  {
+    free(buffer);
+  }
+
+  return new_buffer;
+}
+
+//---------------------------------------------------------------------------//
+
+void _release_capacity(struct kc_vector_t* vector)
+{
+  size_t new_capacity = vector->_capacity;
+
+  // halve the capacity only while the length is less than a quarter of it,
+  // so it takes many pushes before it has to grow again
+  while (vector->length < new_capacity / 4 && new_capacity > KC_VECTOR_SMALL_CAPACITY)
   {
-    vector->data[i] = vector->data[i - 1];
+    new_capacity /= 2;
+  }
+
+  if (new_capacity < KC_VECTOR_SMALL_CAPACITY)
+  {
+    new_capacity = KC_VECTOR_SMALL_CAPACITY;
+  }
+
+  if (new_capacity < vector->_capacity)
+  {
+    _resize_vector(vector, new_capacity);
   }
 }
 
@@ -568,8 +1093,11 @@ void _resize_vector(struct kc_vector_t* vector, size_t new_capacity)
     return;
   }
 
+  // the elements are moved back to the start of the buffer first
+  _close_gap(vector);
+
   // temporarlly store the new data
-  void** new_data = realloc(vector->data, new_capacity * sizeof(void*));
+  void** new_data = (void**)_reallocate_buffer(vector, new_capacity);
 
   // check if the memory reallocation was succesfull
   if (new_data == NULL)
@@ -585,3 +1113,10 @@ void _resize_vector(struct kc_vector_t* vector, size_t new_capacity)
 }
 
 //---------------------------------------------------------------------------//
+
+size_t _slot_size(struct kc_vector_t* vector)
+{
+  return vector->_elem_size != 0 ? vector->_elem_size : sizeof(void*);
+}
+
+//---------------------------------------------------------------------------//
@@ -6,11 +6,15 @@
 // Copyright (c) 2024 Daniel Tanase
 // SPDX-License-Identifier: MIT License
 
+#include "../hdrs/datastructs/bptree.h"
 #include "../hdrs/datastructs/list.h"
+#include "../hdrs/datastructs/mpmc_queue.h"
 #include "../hdrs/datastructs/node.h"
 #include "../hdrs/datastructs/pair.h"
+#include "../hdrs/datastructs/pqueue.h"
 #include "../hdrs/datastructs/queue.h"
 #include "../hdrs/datastructs/set.h"
+#include "../hdrs/datastructs/spsc_queue.h"
 #include "../hdrs/datastructs/tree.h"
 #include "../hdrs/datastructs/stack.h"
 #include "../hdrs/datastructs/vector.h"
@@ -18,6 +22,7 @@
 #include "../hdrs/test.h"
 #include "../hdrs/common.h"
 
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
@@ -31,6 +36,15 @@ int test_list_compare(const void* data_one, const void* data_two)
   return (*(int*)data_one - *(int*)data_two);
 }
 
+// Test case for the sort() method of kc_list_t, only the first of the two
+// numbers is compared.
+int test_list_compare_key(const void* data_one, const void* data_two)
+{
+  return (((int*)data_one)[0] - ((int*)data_two)[0]);
+}
+
+COMPARE_BPTREE(int, bptree_compare_int)
+
 COMPARE_LIST(int, compare_int)
 COMPARE_LIST(char, compare_char)
 COMPARE_LIST(int8_t, compare_int8_t)
@@ -38,9 +52,81 @@ COMPARE_LIST(int8_t, compare_int8_t)
 COMPARE_SET(int, set_compare_int)
 COMPARE_SET(char, set_compare_str)
 
+COMPARE_PQUEUE(int, pqueue_compare_int)
+
 COMPARE_TREE(int, btree_compare_int)
 COMPARE_TREE(char, btree_compare_str)
 
+// Test case for the hash kc_set_t.
+size_t test_set_hash_int(const void* key, size_t key_size)
+{
+  return (size_t)(*(int*)key) * 2654435761u;
+}
+
+// Test case for kc_spsc_queue_t, pushes increasing numbers in batches.
+#define TEST_SPSC_ITEMS 1000000
+
+void* test_spsc_producer(void* arg)
+{
+  struct kc_spsc_queue_t* queue = arg;
+
+  int batch[64];
+  int next = 0;
+
+  while (next < TEST_SPSC_ITEMS)
+  {
+    size_t count = 0;
+    while (count < 64 && next + (int)count < TEST_SPSC_ITEMS)
+    {
+      batch[count] = next + (int)count;
+      ++count;
+    }
+
+    size_t pushed = 0;
+    queue->push(queue, batch, count, &pushed);
+    next += (int)pushed;
+  }
+
+  return NULL;
+}
+
+// Test case for kc_mpmc_queue_t, every producer pushes the same numbers and
+// every consumer sums a share of them.
+#define TEST_MPMC_THREADS 4
+#define TEST_MPMC_ITEMS   100000
+
+void* test_mpmc_producer(void* arg)
+{
+  struct kc_mpmc_queue_t* queue = arg;
+
+  for (long i = 1; i <= TEST_MPMC_ITEMS; ++i)
+  {
+    queue->push(queue, &i);
+  }
+
+  return NULL;
+}
+
+struct test_mpmc_consumer_t
+{
+  struct kc_mpmc_queue_t* queue;
+  long sum;
+};
+
+void* test_mpmc_consumer(void* arg)
+{
+  struct test_mpmc_consumer_t* consumer = arg;
+
+  for (long i = 0; i < TEST_MPMC_ITEMS; ++i)
+  {
+    long item = 0;
+    consumer->queue->pop(consumer->queue, &item);
+    consumer->sum += item;
+  }
+
+  return NULL;
+}
+
 // Test case for kc_tree_t.
 int test_tree_compare(const void* a, const void* b)
 {
@@ -48,12 +134,94 @@ int test_tree_compare(const void* a, const void* b)
     *(int*)(((struct kc_pair_t*)b)->key));
 }
 
+// Test case for kc_tree_t, counts how many times the comparison is called.
+static size_t test_tree_compare_calls = 0;
+
+int test_tree_counting_compare(const void* a, const void* b)
+{
+  ++test_tree_compare_calls;
+
+  return btree_compare_int(a, b);
+}
+
+// Test case for the red-black kc_tree_t, returns the black height of the
+// subtree or -1 if the red-black rules are broken.
+int test_rb_tree_black_height(struct kc_node_t* node, struct kc_node_t* parent)
+{
+  if (node == NULL)
+  {
+    return 1;
+  }
+
+  struct kc_tree_node_t* tree_node = (struct kc_tree_node_t*)node;
+
+  // the parent links must match and a red node can't have a red parent
+  if (tree_node->parent != parent ||
+     (tree_node->red && parent != NULL && ((struct kc_tree_node_t*)parent)->red))
+  {
+    return -1;
+  }
+
+  int left  = test_rb_tree_black_height(node->prev, node);
+  int right = test_rb_tree_black_height(node->next, node);
+
+  // every path must have the same number of black nodes
+  if (left == -1 || left != right)
+  {
+    return -1;
+  }
+
+  return left + (tree_node->red ? 0 : 1);
+}
+
+// Test case for the range() method of kc_tree_t, adds the data up until
+// the sum reaches the limit stored right after it.
+int test_tree_range_sum(void* data, void* context)
+{
+  int* sum = (int*)context;
+  sum[0] += *(int*)data;
+
+  return sum[0] >= sum[1];
+}
+
+// Test case for the range() method of kc_bptree_t, checks that the items
+// come in order and counts them.
+int test_bptree_range_count(void* data, void* context)
+{
+  int* state = (int*)context;
+
+  if (*(int*)data <= state[1])
+  {
+    state[2] = 1;
+  }
+
+  state[0] += 1;
+  state[1] = *(int*)data;
+
+  return 0;
+}
+
+// Test case for the range() method of kc_set_t, counts the visited pairs.
+int test_set_range_count(void* key, void* value, void* context)
+{
+  (*(int*)context) += (*(int*)key == *(int*)value) ? 1 : 0;
+
+  return 0;
+}
+
 // Test case for the search() and remove() method of kc_vector_t.
 int test_vector_compare(const void* a, const void* b)
 {
   return (*(int*)a - *(int*)b);
 }
 
+// Test case for the remove_if() method of kc_vector_t, matches the multiples
+// of the number passed as context.
+bool test_vector_is_multiple(const void* elem, void* context)
+{
+  return (*(int*)elem % *(int*)context) == 0;
+}
+
 int main() {
   testgroup("kc_list_t")
   {
@@ -627,6 +795,314 @@ int main() {
       ok(compare_int8_t(&a_int8_t, &b_int8_t) == 0);
     }
 
+    subtest("test indexed access")
+    {
+      // create a new instance of a List
+      struct kc_list_t* list = new_list();
+
+      // keep a plain array with the expected content of the list
+      static int expected[4000];
+      int length = 0;
+      int ret = KC_INVALID;
+
+      // popping from an empty list is refused
+      ok(list->pop_front(list) == KC_EMPTY_STRUCTURE);
+      ok(list->pop_back(list) == KC_EMPTY_STRUCTURE);
+
+      // grow the list from both ends and from the middle
+      for (int i = 0; i < 3000; ++i)
+      {
+        int index = (i % 3 == 0) ? 0 : (i % 3 == 1) ? length : (i * 7919) % (length + 1);
+
+        ret = list->insert(list, index, &i, sizeof(int));
+        ok(ret == KC_SUCCESS);
+
+        for (int j = length; j > index; --j)
+        {
+          expected[j] = expected[j - 1];
+        }
+
+        expected[index] = i;
+        ++length;
+      }
+
+      // remove some nodes from the middle
+      for (int i = 0; i < 1000; ++i)
+      {
+        int index = (i * 104729) % length;
+
+        ret = list->erase(list, index);
+        ok(ret == KC_SUCCESS);
+
+        for (int j = index; j < length - 1; ++j)
+        {
+          expected[j] = expected[j + 1];
+        }
+
+        --length;
+      }
+
+      ok(list->length == (size_t)length);
+
+      // every index holds the expected value
+      struct kc_node_t* node = NULL;
+      for (int i = 0; i < length; ++i)
+      {
+        ret = list->get(list, i, &node);
+
+        ok(ret == KC_SUCCESS);
+        ok(*(int*)node->data == expected[i]);
+      }
+
+      // the links between the nodes are consistent in both directions
+      ok(list->_head->prev == NULL);
+      ok(list->_head->next->prev == list->_head);
+
+      node = list->_tail;
+      for (int i = length - 1; i >= 0; --i)
+      {
+        ok(*(int*)node->data == expected[i]);
+        node = node->prev;
+      }
+
+      // popping from both ends keeps the indexes in place
+      list->pop_front(list);
+      list->pop_back(list);
+
+      ret = list->get(list, length / 2, &node);
+
+      ok(ret == KC_SUCCESS);
+      ok(*(int*)node->data == expected[length / 2 + 1]);
+
+      destroy_list(list);
+    }
+
+    subtest("test cursor")
+    {
+      // create a new instance of a List
+      struct kc_list_t* list = new_list();
+
+      struct kc_list_cursor_t cursor;
+      int ret = KC_INVALID;
+
+      // insert the numbers from 0 to 99
+      for (int i = 0; i < 100; ++i)
+      {
+        list->push_back(list, &i, sizeof(int));
+      }
+
+      ret = list->cursor(list, 101, &cursor);
+      ok(ret == KC_INDEX_OUT_OF_BOUNDS);
+
+      // in a single pass, remove the even numbers and add the negative of
+      // every odd number after it
+      ret = list->cursor(list, 0, &cursor);
+      ok(ret == KC_SUCCESS);
+
+      while (cursor.node != NULL)
+      {
+        int value = *(int*)cursor.node->data;
+
+        if (value % 2 == 0)
+        {
+          ret = list->erase_at(list, &cursor);
+        }
+        else
+        {
+          int negative = -value;
+
+          ret = list->insert_after(list, &cursor, &negative, sizeof(int));
+          ok(ret == KC_SUCCESS);
+
+          // step over the inserted node as well
+          list->cursor_next(list, &cursor);
+          ret = list->cursor_next(list, &cursor);
+        }
+
+        ok(ret == KC_SUCCESS);
+      }
+
+      ok(cursor.index == 100);
+      ok(list->length == 100);
+
+      // the cursor can't move past the tail, but it can go back to it
+      ok(list->cursor_next(list, &cursor) == KC_INDEX_OUT_OF_BOUNDS);
+      ok(list->insert_after(list, &cursor, &ret, sizeof(int)) == KC_INDEX_OUT_OF_BOUNDS);
+
+      ret = list->cursor_prev(list, &cursor);
+      ok(ret == KC_SUCCESS);
+      ok(cursor.node == list->_tail);
+      ok(*(int*)cursor.node->data == -99);
+
+      // the indexes see the edits made through the cursor
+      struct kc_node_t* node = NULL;
+      for (int i = 0; i < 50; ++i)
+      {
+        list->get(list, 2 * i, &node);
+        ok(*(int*)node->data == 2 * i + 1);
+
+        list->get(list, 2 * i + 1, &node);
+        ok(*(int*)node->data == -(2 * i + 1));
+      }
+
+      // insert before the second node, the cursor keeps pointing to it
+      list->cursor(list, 1, &cursor);
+
+      int value = 1000;
+      ret = list->insert_before(list, &cursor, &value, sizeof(int));
+
+      ok(ret == KC_SUCCESS);
+      ok(cursor.index == 2);
+      ok(*(int*)cursor.node->data == -1);
+
+      list->get(list, 1, &node);
+      ok(*(int*)node->data == 1000);
+
+      // the cursor goes back to the head, where it can't go further
+      list->cursor_prev(list, &cursor);
+      list->cursor_prev(list, &cursor);
+
+      ok(cursor.node == list->_head);
+      ok(list->cursor_prev(list, &cursor) == KC_INDEX_OUT_OF_BOUNDS);
+
+      destroy_list(list);
+    }
+
+    subtest("test concat(), splice() & split()")
+    {
+      // create two new instances of a List
+      struct kc_list_t* list  = new_list();
+      struct kc_list_t* other = new_list();
+
+      struct kc_list_cursor_t cursor, first, last;
+      int ret = KC_INVALID;
+
+      // the first list holds 0 to 9, the other one 10 to 19
+      for (int i = 0; i < 10; ++i)
+      {
+        int value = i + 10;
+
+        list->push_back(list, &i, sizeof(int));
+        other->push_back(other, &value, sizeof(int));
+      }
+
+      // move all the nodes of the other list after the tail
+      ret = list->concat(list, other);
+
+      ok(ret == KC_SUCCESS);
+      ok(list->length == 20);
+      ok(other->length == 0);
+      ok(other->_head == NULL && other->_tail == NULL);
+      ok(list->concat(list, list) == KC_INVALID);
+
+      // move the nodes from 15 onwards back into the other list
+      list->cursor(list, 15, &cursor);
+      ret = list->split(list, &cursor, other);
+
+      ok(ret == KC_SUCCESS);
+      ok(cursor.node == NULL);
+      ok(list->length == 15);
+      ok(other->length == 5);
+      ok(*(int*)list->_tail->data == 14);
+      ok(*(int*)other->_head->data == 15);
+      ok(other->_head->prev == NULL);
+
+      // move the nodes from 2 to 4 in front of the 17
+      list->cursor(list, 2, &first);
+      list->cursor(list, 5, &last);
+      other->cursor(other, 2, &cursor);
+
+      ret = other->splice(other, &cursor, list, &first, &last);
+
+      ok(ret == KC_SUCCESS);
+      ok(list->length == 12);
+      ok(other->length == 8);
+      ok(cursor.index == 5);
+      ok(*(int*)cursor.node->data == 17);
+      ok(first.node == last.node && first.index == 2);
+      ok(*(int*)first.node->data == 5);
+
+      // the indexes of both lists see the moved nodes
+      int expected_list[]  = { 0, 1, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14 };
+      int expected_other[] = { 15, 16, 2, 3, 4, 17, 18, 19 };
+
+      struct kc_node_t* node = NULL;
+      for (int i = 0; i < 12; ++i)
+      {
+        list->get(list, i, &node);
+        ok(*(int*)node->data == expected_list[i]);
+      }
+
+      for (int i = 0; i < 8; ++i)
+      {
+        other->get(other, i, &node);
+        ok(*(int*)node->data == expected_other[i]);
+      }
+
+      // the nodes moved into the other list outlive the first one
+      destroy_list(list);
+
+      other->pop_back(other);
+      other->get(other, 3, &node);
+      ok(*(int*)node->data == 3);
+
+      other->clear(other);
+      ok(other->length == 0);
+
+      int value = 42;
+      other->push_back(other, &value, sizeof(int));
+      ok(*(int*)other->_head->data == 42);
+
+      destroy_list(other);
+    }
+
+    subtest("test sort()")
+    {
+      // create a new instance of a List
+      struct kc_list_t* list = new_list();
+
+      int ret = KC_INVALID;
+
+      // sorting an empty list does nothing
+      ret = list->sort(list, test_list_compare_key);
+      ok(ret == KC_SUCCESS);
+
+      // insert 1000 pairs with only 10 different keys, the second
+      // number keeps the order of the insertion
+      for (int i = 0; i < 1000; ++i)
+      {
+        int pair[2] = { (i * 7) % 10, i };
+        list->push_back(list, pair, sizeof(pair));
+      }
+
+      ret = list->sort(list, test_list_compare_key);
+      ok(ret == KC_SUCCESS);
+      ok(list->length == 1000);
+
+      // the keys are ordered, and the equal keys keep their order
+      struct kc_node_t* node = list->_head;
+      ok(node->prev == NULL);
+
+      for (int i = 0; i < 999; ++i)
+      {
+        int* pair = node->data;
+        int* next = node->next->data;
+
+        ok(pair[0] < next[0] || (pair[0] == next[0] && pair[1] < next[1]));
+        ok(node->next->prev == node);
+
+        node = node->next;
+      }
+
+      ok(node == list->_tail);
+
+      // the index sees the new order
+      list->get(list, 500, &node);
+      ok(((int*)node->data)[0] == 5);
+
+      destroy_list(list);
+    }
+
     done_testing()
   }
 
@@ -769,6 +1245,75 @@ int main() {
       node_destructor(node);
     }
 
+    subtest("test inline data")
+    {
+      long long data = 0x1122334455667788;
+      struct kc_node_t* node = node_constructor(&data, sizeof(data));
+
+      // the data follows the node in the same allocation
+      ok((unsigned char*)node->data >= (unsigned char*)(node + 1));
+      ok((unsigned char*)node->data < (unsigned char*)(node + 1) + 2 * sizeof(void*));
+      ok(*(long long*)node->data == data);
+
+      node_destructor(node);
+    }
+
+    subtest("test pooled nodes")
+    {
+      struct kc_node_pool_t* pool = new_node_pool(sizeof(struct kc_node_t));
+      struct kc_node_t* nodes[KC_NODE_POOL_CHUNK_SIZE * 2 + 1];
+
+      // take more nodes than a single chunk holds
+      for (int i = 0; i < KC_NODE_POOL_CHUNK_SIZE * 2 + 1; ++i)
+      {
+        nodes[i] = pooled_node_constructor(pool, &i, sizeof(int));
+        ok(nodes[i] != NULL);
+        ok(*(int*)nodes[i]->data == i);
+        ok(nodes[i]->next == NULL && nodes[i]->prev == NULL);
+      }
+
+      ok(*(int*)nodes[0]->data == 0);
+      ok(*(int*)nodes[KC_NODE_POOL_CHUNK_SIZE * 2]->data == KC_NODE_POOL_CHUNK_SIZE * 2);
+
+      // the last released node is the first one to be reused
+      struct kc_node_t* released = nodes[10];
+      pooled_node_destructor(pool, nodes[10]);
+
+      int value = 42;
+      nodes[10] = pooled_node_constructor(pool, &value, sizeof(int));
+      ok(nodes[10] == released);
+      ok(*(int*)nodes[10]->data == 42);
+
+      // free the data of the nodes and release all of them at once
+      for (int i = 0; i < KC_NODE_POOL_CHUNK_SIZE * 2 + 1; ++i)
+      {
+        pooled_node_free_data(pool, nodes[i]);
+      }
+
+      clear_node_pool(pool);
+
+      // the pool can be used again after being cleared
+      struct kc_node_t* node = pooled_node_constructor(pool, &value, sizeof(int));
+      ok(node != NULL);
+      ok(*(int*)node->data == 42);
+
+      // small data is kept inside the slot, bigger data on its own
+      ok((unsigned char*)node->data > (unsigned char*)node);
+      ok((unsigned char*)node->data < (unsigned char*)node + pool->_slot_size);
+
+      char big[KC_NODE_INLINE_SIZE * 2];
+      memset(big, 'k', sizeof(big));
+
+      struct kc_node_t* big_node = pooled_node_constructor(pool, big, sizeof(big));
+      ok(big_node != NULL);
+      ok(memcmp(big_node->data, big, sizeof(big)) == 0);
+
+      pooled_node_destructor(pool, node);
+      pooled_node_destructor(pool, big_node);
+
+      destroy_node_pool(pool);
+    }
+
     done_testing()
   }
 
@@ -941,15 +1486,148 @@ int main() {
     done_testing()
   }
 
-  testgroup("kc_queue_t")
+  testgroup("kc_pqueue_t")
   {
     subtest("test init/desc")
     {
-      struct kc_queue_t* queue = new_queue();
+      struct kc_pqueue_t* pqueue = new_pqueue(pqueue_compare_int, sizeof(int));
 
-      ok(queue->_list->_head == NULL);
+      size_t length = 1;
+      pqueue->length(pqueue, &length);
+      ok(length == 0);
 
-      destroy_queue(queue);
+      void* top = NULL;
+      ok(pqueue->top(pqueue, &top) == KC_EMPTY_STRUCTURE);
+      ok(pqueue->pop(pqueue) == KC_EMPTY_STRUCTURE);
+
+      destroy_pqueue(pqueue);
+    }
+
+    subtest("test push() & pop()")
+    {
+      struct kc_pqueue_t* pqueue = new_pqueue(pqueue_compare_int, sizeof(int));
+
+      int ret = KC_INVALID;
+
+      // push the numbers in a scrambled order
+      for (int i = 0; i < 1000; ++i)
+      {
+        int item = (i * 7919) % 1000;
+        ret = pqueue->push(pqueue, &item, sizeof(int));
+        ok(ret == KC_SUCCESS);
+      }
+
+      size_t length = 0;
+      pqueue->length(pqueue, &length);
+      ok(length == 1000);
+
+      // the items come out from the greatest to the smallest
+      for (int i = 999; i >= 0; --i)
+      {
+        void* top = NULL;
+        ret = pqueue->top(pqueue, &top);
+        ok(ret == KC_SUCCESS);
+        ok(*(int*)top == i);
+
+        ret = pqueue->pop(pqueue);
+        ok(ret == KC_SUCCESS);
+      }
+
+      pqueue->length(pqueue, &length);
+      ok(length == 0);
+
+      destroy_pqueue(pqueue);
+    }
+
+    subtest("test push_n()")
+    {
+      struct kc_pqueue_t* pqueue = new_pqueue(pqueue_compare_int, sizeof(int));
+
+      int ret = KC_INVALID;
+      int items[500];
+
+      // push a large batch first, then a few small ones
+      for (int i = 0; i < 500; ++i)
+      {
+        items[i] = (i * 7919) % 500;
+      }
+
+      ret = pqueue->push_n(pqueue, items, 500);
+      ok(ret == KC_SUCCESS);
+
+      for (int i = 0; i < 10; ++i)
+      {
+        int batch[] = { 500 + i, -1 - i };
+        ret = pqueue->push_n(pqueue, batch, 2);
+        ok(ret == KC_SUCCESS);
+      }
+
+      size_t length = 0;
+      pqueue->length(pqueue, &length);
+      ok(length == 520);
+
+      // the items come out from the greatest to the smallest
+      int previous = 1000;
+      bool in_order = true;
+      for (int i = 0; i < 520; ++i)
+      {
+        void* top = NULL;
+        pqueue->top(pqueue, &top);
+
+        in_order = in_order && *(int*)top <= previous;
+        previous = *(int*)top;
+
+        pqueue->pop(pqueue);
+      }
+
+      ok(in_order == true);
+      ok(previous == -10);
+
+      destroy_pqueue(pqueue);
+    }
+
+    subtest("test new_pqueue_from_vector()")
+    {
+      struct kc_vector_t* vector = new_vector_of(sizeof(int));
+
+      for (int i = 0; i < 100; ++i)
+      {
+        int item = (i * 37) % 100;
+        vector->push_back(vector, &item, sizeof(int));
+      }
+
+      struct kc_pqueue_t* pqueue = new_pqueue_from_vector(pqueue_compare_int, vector);
+      ok(pqueue != NULL);
+
+      // the vector is left untouched
+      ok(vector->length == 100);
+      ok(((int*)vector->data)[1] == 37);
+
+      for (int i = 99; i >= 0; --i)
+      {
+        void* top = NULL;
+        pqueue->top(pqueue, &top);
+        ok(*(int*)top == i);
+
+        pqueue->pop(pqueue);
+      }
+
+      destroy_pqueue(pqueue);
+      destroy_vector(vector);
+    }
+
+    done_testing()
+  }
+
+  testgroup("kc_queue_t")
+  {
+    subtest("test init/desc")
+    {
+      struct kc_queue_t* queue = new_queue();
+
+      ok(queue->_list->_head == NULL);
+
+      destroy_queue(queue);
     }
 
     subtest("test length()")
@@ -1149,167 +1827,786 @@ int main() {
       destroy_queue(queue);
     }
 
-    done_testing()
-  }
-
-  testgroup("kc_set_t")
-  {
-    subtest("test init/desc")
+    subtest("test ring push() & pop()")
     {
-      struct kc_set_t* set = new_set(set_compare_int);
+      struct kc_queue_t* queue = new_ring_queue();
 
-      ok(set->_entries->root == NULL);
+      int ret = KC_INVALID;
+      size_t length = 1;
+      void* data = NULL;
 
-      destroy_set(set);
-    }
+      ok(queue->_list == NULL);
 
-    subtest("test insert() & search()")
-    {
-      // create a new instance of a Set
-      struct kc_set_t* set = new_set(set_compare_int);
+      // the queue should be empty
+      ret = queue->length(queue, &length);
+      ok(ret == KC_SUCCESS);
+      ok(length == 0);
 
-      int ret = KC_INVALID;
+      ret = queue->peek(queue, &data);
+      ok(ret == KC_EMPTY_STRUCTURE);
 
+      ret = queue->pop(queue);
+      ok(ret == KC_EMPTY_STRUCTURE);
 
-      // insert ten new entries
-      for (int i = 0; i < 10; ++i)
+      // push items of different sizes, enough to grow the buffer
+      for (int i = 0; i < 100; ++i)
       {
-        int val = i * 100;
+        if (i % 2 == 0)
+        {
+          ret = queue->push(queue, &i, sizeof(int));
+        }
+        else
+        {
+          char str[32];
+          sprintf(str, "item %d", i);
+          ret = queue->push(queue, str, strlen(str) + 1);
+        }
 
-        // use the "i" variable as the "key" and the "val" variable as the value
-        ret = set->insert(set, &i, sizeof(int), &val, sizeof(int));
         ok(ret == KC_SUCCESS);
       }
 
-      // search for the newlly created entries
-      for (int i = 0; i < 10; ++i)
-      {
-        void* searchable = NULL;
-        ret = set->search(set, &i, sizeof(int), &searchable);
+      ret = queue->length(queue, &length);
+      ok(ret == KC_SUCCESS);
+      ok(length == 100);
 
-        // check the data inserted
+      // the items come out in the same order
+      for (int i = 0; i < 100; ++i)
+      {
+        ret = queue->peek(queue, &data);
         ok(ret == KC_SUCCESS);
-        ok(*(int*)searchable == i * 100);
-      }
 
-      // search again, but in reverse
-      for (int i = 9; i >= 0; --i)
-      {
-        void* searchable = NULL;
-        ret = set->search(set, &i, sizeof(int), &searchable);
+        if (i % 2 == 0)
+        {
+          ok(*(int*)data == i);
+        }
+        else
+        {
+          char str[32];
+          sprintf(str, "item %d", i);
+          ok(strcmp((char*)data, str) == 0);
+        }
 
-        // check the data inserted
+        ret = queue->pop(queue);
         ok(ret == KC_SUCCESS);
-        ok(*(int*)searchable == i * 100);
       }
 
-      destroy_set(set);
+      ret = queue->length(queue, &length);
+      ok(ret == KC_SUCCESS);
+      ok(length == 0);
+
+      destroy_queue(queue);
     }
 
-    // Test case for remove() method
-    subtest("test remove()")
+    subtest("test ring wrap around")
     {
-      struct kc_set_t* set = new_set(set_compare_int);
+      struct kc_queue_t* queue = new_ring_queue();
 
       int ret = KC_INVALID;
+      void* data = NULL;
+      int next_push = 0;
+      int next_pop = 0;
 
-      // insert 10 new entries
-      for (int i = 0; i < 10; ++i)
+      // keep a few items in the queue, so the buffer wraps around
+      for (int i = 0; i < 5; ++i)
       {
-        ret = set->insert(set, &i, sizeof(int), &i, sizeof(int));
+        ret = queue->push(queue, &next_push, sizeof(int));
+        ok(ret == KC_SUCCESS);
+        ++next_push;
+      }
+
+      size_t capacity = queue->_capacity;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        ret = queue->push(queue, &next_push, sizeof(int));
+        ok(ret == KC_SUCCESS);
+        ++next_push;
 
+        ret = queue->peek(queue, &data);
+        ok(ret == KC_SUCCESS);
+        ok(*(int*)data == next_pop);
+
+        ret = queue->pop(queue);
         ok(ret == KC_SUCCESS);
+        ++next_pop;
       }
 
-      // remove the pair and check it's existance
-      int pair_to_remove = 5;
-      void* searchable = 0;
+      // the buffer didn't need to grow
+      ok(queue->_capacity == capacity);
 
-      ret = set->remove(set, &pair_to_remove, sizeof(int));
-      ok(ret == KC_SUCCESS);
+      // grow the buffer while it is wrapped around
+      for (int i = 0; i < 100; ++i)
+      {
+        ret = queue->push(queue, &next_push, sizeof(int));
+        ok(ret == KC_SUCCESS);
+        ++next_push;
+      }
 
-      ret = set->search(set, &pair_to_remove, sizeof(int), searchable);
-      ok(searchable == NULL);
+      ok(queue->_capacity > capacity);
 
-      pair_to_remove = 0;
-      ret = set->remove(set, &pair_to_remove, sizeof(int));
-      ok(ret == KC_SUCCESS);
+      while (next_pop < next_push)
+      {
+        ret = queue->peek(queue, &data);
+        ok(ret == KC_SUCCESS);
+        ok(*(int*)data == next_pop);
 
-      ret = set->search(set, &pair_to_remove, sizeof(int), searchable);
-      ok(searchable == NULL);
+        ret = queue->pop(queue);
+        ok(ret == KC_SUCCESS);
+        ++next_pop;
+      }
 
-      pair_to_remove = 9;
-      ret = set->remove(set, &pair_to_remove, sizeof(int));
-      ok(ret == KC_SUCCESS);
+      destroy_queue(queue);
+    }
 
-      ret = set->search(set, &pair_to_remove, sizeof(int), searchable);
-      ok(searchable == NULL);
+    done_testing()
+  }
 
-      destroy_set(set);
+  testgroup("kc_spsc_queue_t")
+  {
+    subtest("test init/desc")
+    {
+      struct kc_spsc_queue_t* queue = new_spsc_queue(100, sizeof(int));
+
+      // the capacity is rounded up to a power of two
+      ok(queue != NULL);
+      ok(queue->_capacity == 128);
+
+      size_t length = 1;
+      queue->length(queue, &length);
+      ok(length == 0);
+
+      destroy_spsc_queue(queue);
+
+      ok(new_spsc_queue(0, sizeof(int)) == NULL);
     }
 
-    // Test comparing strings in the binary tree
-    subtest("test str compare")
+    subtest("test push() & pop()")
     {
-      struct kc_set_t* set = new_set(set_compare_str);
+      struct kc_spsc_queue_t* queue = new_spsc_queue(8, sizeof(int));
 
       int ret = KC_INVALID;
+      size_t pushed = 0;
+      size_t popped = 0;
+      int items[16];
 
-      char key1[] = "1";
-      char val1[] = "apple";
-      ret = set->insert(set, &key1, strlen(key1) + 1, &val1, strlen(val1) + 1);
+      // the queue is empty
+      ret = queue->pop(queue, items, 1, &popped);
       ok(ret == KC_SUCCESS);
+      ok(popped == 0);
 
-      char key2[] = "2";
-      char val2[] = "banana";
-      ret = set->insert(set, &key2, strlen(key2) + 1, &val2, strlen(val2) + 1);
-      ok(ret == KC_SUCCESS);
+      // fill the queue, only 8 items fit
+      for (int i = 0; i < 16; ++i)
+      {
+        items[i] = i;
+      }
 
-      char key3[] = "3";
-      char val3[] = "cherry";
-      ret = set->insert(set, &key3, strlen(key3) + 1, &val3, strlen(val3) + 1);
+      ret = queue->push(queue, items, 16, &pushed);
       ok(ret == KC_SUCCESS);
+      ok(pushed == 8);
 
-      void* found = NULL;
-      ret = set->search(set, &key1, strlen(key1) + 1, &found);
+      // pop a few, then push again so the items wrap around
+      ret = queue->pop(queue, items, 5, &popped);
       ok(ret == KC_SUCCESS);
-      ok(strcmp((char*)found, val1) == 0);
+      ok(popped == 5);
 
-      ret = set->search(set, &key2, strlen(key2) + 1, &found);
+      for (int i = 0; i < 5; ++i)
+      {
+        ok(items[i] == i);
+      }
+
+      int more[] = { 8, 9, 10, 11, 12 };
+      ret = queue->push(queue, more, 5, &pushed);
       ok(ret == KC_SUCCESS);
-      ok(strcmp((char*)found, val2) == 0);
+      ok(pushed == 5);
 
-      ret = set->search(set, &key3, strlen(key3) + 1, &found);
+      size_t length = 0;
+      queue->length(queue, &length);
+      ok(length == 8);
+
+      // the items come out in order
+      ret = queue->pop(queue, items, 16, &popped);
       ok(ret == KC_SUCCESS);
-      ok(strcmp((char*)found, val3) == 0);
+      ok(popped == 8);
 
-      destroy_set(set);
+      for (int i = 0; i < 8; ++i)
+      {
+        ok(items[i] == i + 5);
+      }
+
+      destroy_spsc_queue(queue);
+    }
+
+    subtest("test two threads")
+    {
+      struct kc_spsc_queue_t* queue = new_spsc_queue(1024, sizeof(int));
+
+      pthread_t producer;
+      pthread_create(&producer, NULL, test_spsc_producer, queue);
+
+      // the consumer must see every item, in order
+      int expected = 0;
+      bool in_order = true;
+      int batch[64];
+
+      while (expected < TEST_SPSC_ITEMS)
+      {
+        size_t popped = 0;
+        queue->pop(queue, batch, 64, &popped);
+
+        for (size_t i = 0; i < popped; ++i)
+        {
+          in_order = in_order && batch[i] == expected;
+          ++expected;
+        }
+      }
+
+      pthread_join(producer, NULL);
+
+      ok(in_order == true);
+      ok(expected == TEST_SPSC_ITEMS);
+
+      destroy_spsc_queue(queue);
     }
 
     done_testing()
   }
 
-  testgroup("kc_tree_t")
+  testgroup("kc_mpmc_queue_t")
   {
     subtest("test init/desc")
     {
-      struct kc_tree_t* tree = new_tree(btree_compare_int);
+      struct kc_mpmc_queue_t* queue = new_mpmc_queue(10, sizeof(int));
 
-      ok(tree->root == NULL);
+      // the capacity is rounded up to a power of two
+      ok(queue != NULL);
+      ok(queue->_capacity == 16);
 
-      destroy_tree(tree);
+      size_t length = 1;
+      queue->length(queue, &length);
+      ok(length == 0);
+
+      destroy_mpmc_queue(queue);
+
+      ok(new_mpmc_queue(16, 0) == NULL);
     }
 
-    subtest("test insert() & search()")
+    subtest("test capacity of one")
     {
-      struct kc_tree_t* tree = new_tree(btree_compare_int);
+      struct kc_mpmc_queue_t* queue = new_mpmc_queue(1, sizeof(int));
 
       int ret = KC_INVALID;
+      bool moved = false;
+      int item = 0;
 
-      // insert 30 new nodes
-      for (int data = 0; data < 30; ++data)
-      {
-        ret = tree->insert(tree, &data, sizeof(int));
+      // a single cell is rounded up to two
+      ok(queue != NULL);
+      ok(queue->_capacity == 2);
+
+      for (int i = 0; i < 2; ++i)
+      {
+        ret = queue->try_push(queue, &i, &moved);
+        ok(ret == KC_SUCCESS);
+        ok(moved == true);
+      }
+
+      // the push past the capacity fails instead of overwriting an item
+      int extra = 2;
+      ret = queue->try_push(queue, &extra, &moved);
+      ok(ret == KC_SUCCESS);
+      ok(moved == false);
+
+      for (int i = 0; i < 2; ++i)
+      {
+        ret = queue->try_pop(queue, &item, &moved);
+        ok(ret == KC_SUCCESS);
+        ok(moved == true);
+        ok(item == i);
+      }
+
+      // the pop on the empty queue returns right away
+      ret = queue->try_pop(queue, &item, &moved);
+      ok(ret == KC_SUCCESS);
+      ok(moved == false);
+
+      destroy_mpmc_queue(queue);
+    }
+
+    subtest("test try_push() & try_pop()")
+    {
+      struct kc_mpmc_queue_t* queue = new_mpmc_queue(4, sizeof(int));
+
+      int ret = KC_INVALID;
+      bool moved = true;
+      int item = 0;
+
+      // the queue is empty
+      ret = queue->try_pop(queue, &item, &moved);
+      ok(ret == KC_SUCCESS);
+      ok(moved == false);
+
+      // only 4 items fit
+      for (int i = 0; i < 4; ++i)
+      {
+        ret = queue->try_push(queue, &i, &moved);
+        ok(ret == KC_SUCCESS);
+        ok(moved == true);
+      }
+
+      int extra = 4;
+      ret = queue->try_push(queue, &extra, &moved);
+      ok(ret == KC_SUCCESS);
+      ok(moved == false);
+
+      size_t length = 0;
+      queue->length(queue, &length);
+      ok(length == 4);
+
+      // go around the buffer a few times
+      for (int i = 0; i < 20; ++i)
+      {
+        ret = queue->try_pop(queue, &item, &moved);
+        ok(ret == KC_SUCCESS);
+        ok(moved == true);
+        ok(item == i);
+
+        int next = i + 4;
+        ret = queue->try_push(queue, &next, &moved);
+        ok(ret == KC_SUCCESS);
+        ok(moved == true);
+      }
+
+      destroy_mpmc_queue(queue);
+    }
+
+    subtest("test many threads")
+    {
+      struct kc_mpmc_queue_t* queue = new_mpmc_queue(256, sizeof(long));
+
+      pthread_t producers[TEST_MPMC_THREADS];
+      pthread_t consumers[TEST_MPMC_THREADS];
+      struct test_mpmc_consumer_t results[TEST_MPMC_THREADS];
+
+      for (int i = 0; i < TEST_MPMC_THREADS; ++i)
+      {
+        results[i].queue = queue;
+        results[i].sum = 0;
+        pthread_create(&consumers[i], NULL, test_mpmc_consumer, &results[i]);
+        pthread_create(&producers[i], NULL, test_mpmc_producer, queue);
+      }
+
+      long total = 0;
+      for (int i = 0; i < TEST_MPMC_THREADS; ++i)
+      {
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+        total += results[i].sum;
+      }
+
+      // every item was taken exactly once
+      long expected = (long)TEST_MPMC_THREADS * TEST_MPMC_ITEMS * (TEST_MPMC_ITEMS + 1) / 2;
+      ok(total == expected);
+
+      size_t length = 1;
+      queue->length(queue, &length);
+      ok(length == 0);
+
+      destroy_mpmc_queue(queue);
+    }
+
+    done_testing()
+  }
+
+  testgroup("kc_set_t")
+  {
+    subtest("test init/desc")
+    {
+      struct kc_set_t* set = new_set(set_compare_int);
+
+      ok(set->_entries->root == NULL);
+
+      destroy_set(set);
+    }
+
+    subtest("test insert() & search()")
+    {
+      // create a new instance of a Set
+      struct kc_set_t* set = new_set(set_compare_int);
+
+      int ret = KC_INVALID;
+
+
+      // insert ten new entries
+      for (int i = 0; i < 10; ++i)
+      {
+        int val = i * 100;
+
+        // use the "i" variable as the "key" and the "val" variable as the value
+        ret = set->insert(set, &i, sizeof(int), &val, sizeof(int));
+        ok(ret == KC_SUCCESS);
+      }
+
+      // search for the newlly created entries
+      for (int i = 0; i < 10; ++i)
+      {
+        void* searchable = NULL;
+        ret = set->search(set, &i, sizeof(int), &searchable);
+
+        // check the data inserted
+        ok(ret == KC_SUCCESS);
+        ok(*(int*)searchable == i * 100);
+      }
+
+      // search again, but in reverse
+      for (int i = 9; i >= 0; --i)
+      {
+        void* searchable = NULL;
+        ret = set->search(set, &i, sizeof(int), &searchable);
+
+        // check the data inserted
+        ok(ret == KC_SUCCESS);
+        ok(*(int*)searchable == i * 100);
+      }
+
+      destroy_set(set);
+    }
+
+    // Test case for remove() method
+    subtest("test remove()")
+    {
+      struct kc_set_t* set = new_set(set_compare_int);
+
+      int ret = KC_INVALID;
+
+      // insert 10 new entries
+      for (int i = 0; i < 10; ++i)
+      {
+        ret = set->insert(set, &i, sizeof(int), &i, sizeof(int));
+
+        ok(ret == KC_SUCCESS);
+      }
+
+      // remove the pair and check it's existance
+      int pair_to_remove = 5;
+      void* searchable = 0;
+
+      ret = set->remove(set, &pair_to_remove, sizeof(int));
+      ok(ret == KC_SUCCESS);
+
+      ret = set->search(set, &pair_to_remove, sizeof(int), searchable);
+      ok(searchable == NULL);
+
+      pair_to_remove = 0;
+      ret = set->remove(set, &pair_to_remove, sizeof(int));
+      ok(ret == KC_SUCCESS);
+
+      ret = set->search(set, &pair_to_remove, sizeof(int), searchable);
+      ok(searchable == NULL);
+
+      pair_to_remove = 9;
+      ret = set->remove(set, &pair_to_remove, sizeof(int));
+      ok(ret == KC_SUCCESS);
+
+      ret = set->search(set, &pair_to_remove, sizeof(int), searchable);
+      ok(searchable == NULL);
+
+      destroy_set(set);
+    }
+
+    subtest("test insert() existing key")
+    {
+      struct kc_set_t* set = new_set(set_compare_int);
+
+      int ret = KC_INVALID;
+      int key = 7, val = 70, other = 80;
+
+      ret = set->insert(set, &key, sizeof(int), &val, sizeof(int));
+      ok(ret == KC_SUCCESS);
+
+      // inserting the same key again keeps the first value
+      ret = set->insert(set, &key, sizeof(int), &other, sizeof(int));
+      ok(ret == KC_SUCCESS);
+
+      void* found = NULL;
+      ret = set->search(set, &key, sizeof(int), &found);
+      ok(ret == KC_SUCCESS);
+      ok(*(int*)found == val);
+
+      // removing a missing key does nothing
+      int missing = 8;
+      ret = set->remove(set, &missing, sizeof(int));
+      ok(ret == KC_SUCCESS);
+
+      ret = set->remove(set, &key, sizeof(int));
+      ok(ret == KC_SUCCESS);
+      ok(set->_entries->root == NULL);
+
+      destroy_set(set);
+    }
+
+    // Test comparing strings in the binary tree
+    subtest("test str compare")
+    {
+      struct kc_set_t* set = new_set(set_compare_str);
+
+      int ret = KC_INVALID;
+
+      char key1[] = "1";
+      char val1[] = "apple";
+      ret = set->insert(set, &key1, strlen(key1) + 1, &val1, strlen(val1) + 1);
+      ok(ret == KC_SUCCESS);
+
+      char key2[] = "2";
+      char val2[] = "banana";
+      ret = set->insert(set, &key2, strlen(key2) + 1, &val2, strlen(val2) + 1);
+      ok(ret == KC_SUCCESS);
+
+      char key3[] = "3";
+      char val3[] = "cherry";
+      ret = set->insert(set, &key3, strlen(key3) + 1, &val3, strlen(val3) + 1);
+      ok(ret == KC_SUCCESS);
+
+      void* found = NULL;
+      ret = set->search(set, &key1, strlen(key1) + 1, &found);
+      ok(ret == KC_SUCCESS);
+      ok(strcmp((char*)found, val1) == 0);
+
+      ret = set->search(set, &key2, strlen(key2) + 1, &found);
+      ok(ret == KC_SUCCESS);
+      ok(strcmp((char*)found, val2) == 0);
+
+      ret = set->search(set, &key3, strlen(key3) + 1, &found);
+      ok(ret == KC_SUCCESS);
+      ok(strcmp((char*)found, val3) == 0);
+
+      destroy_set(set);
+    }
+
+    subtest("test hash set insert() & search()")
+    {
+      struct kc_set_t* set = new_hash_set(test_set_hash_int, set_compare_int);
+
+      int ret = KC_INVALID;
+
+      // insert enough entries to grow the table a few times
+      for (int i = 0; i < 1000; ++i)
+      {
+        int val = i * 100;
+
+        ret = set->insert(set, &i, sizeof(int), &val, sizeof(int));
+        ok(ret == KC_SUCCESS);
+      }
+
+      // inserting an existing key keeps the old value
+      int key = 10, val = -1;
+      ret = set->insert(set, &key, sizeof(int), &val, sizeof(int));
+      ok(ret == KC_SUCCESS);
+      ok(set->_length == 1000);
+
+      // search for the newlly created entries
+      for (int i = 0; i < 1000; ++i)
+      {
+        void* searchable = NULL;
+        ret = set->search(set, &i, sizeof(int), &searchable);
+
+        ok(ret == KC_SUCCESS);
+        ok(searchable != NULL);
+        ok(*(int*)searchable == i * 100);
+      }
+
+      // search for a missing entry
+      key = 1000;
+      void* searchable = NULL;
+      ret = set->search(set, &key, sizeof(int), &searchable);
+      ok(ret == KC_SUCCESS);
+      ok(searchable == NULL);
+
+      destroy_set(set);
+    }
+
+    subtest("test hash set remove()")
+    {
+      struct kc_set_t* set = new_hash_set(test_set_hash_int, set_compare_int);
+
+      int ret = KC_INVALID;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        ret = set->insert(set, &i, sizeof(int), &i, sizeof(int));
+        ok(ret == KC_SUCCESS);
+      }
+
+      // remove and insert the entries over and over, reusing the slots
+      for (int round = 0; round < 10; ++round)
+      {
+        for (int i = 0; i < 100; i += 2)
+        {
+          ret = set->remove(set, &i, sizeof(int));
+          ok(ret == KC_SUCCESS);
+        }
+
+        ok(set->_length == 50);
+
+        for (int i = 0; i < 100; ++i)
+        {
+          void* searchable = NULL;
+          ret = set->search(set, &i, sizeof(int), &searchable);
+
+          ok(ret == KC_SUCCESS);
+          ok((searchable != NULL) == (i % 2 == 1));
+        }
+
+        for (int i = 0; i < 100; i += 2)
+        {
+          ret = set->insert(set, &i, sizeof(int), &i, sizeof(int));
+          ok(ret == KC_SUCCESS);
+        }
+
+        ok(set->_length == 100);
+      }
+
+      destroy_set(set);
+    }
+
+    subtest("test hash set default hash")
+    {
+      struct kc_set_t* set = new_hash_set(NULL, set_compare_str);
+
+      int ret = KC_INVALID;
+
+      char key1[] = "1";
+      char val1[] = "apple";
+      ret = set->insert(set, &key1, strlen(key1) + 1, &val1, strlen(val1) + 1);
+      ok(ret == KC_SUCCESS);
+
+      char key2[] = "2";
+      char val2[] = "banana";
+      ret = set->insert(set, &key2, strlen(key2) + 1, &val2, strlen(val2) + 1);
+      ok(ret == KC_SUCCESS);
+
+      void* found = NULL;
+      ret = set->search(set, &key1, strlen(key1) + 1, &found);
+      ok(ret == KC_SUCCESS);
+      ok(strcmp((char*)found, val1) == 0);
+
+      ret = set->search(set, &key2, strlen(key2) + 1, &found);
+      ok(ret == KC_SUCCESS);
+      ok(strcmp((char*)found, val2) == 0);
+
+      destroy_set(set);
+    }
+
+    subtest("test ordered iteration")
+    {
+      struct kc_set_t* set = new_set(set_compare_int);
+
+      // insert the keys in reverse, every value is equal to its key
+      for (int key = 49; key >= 0; --key)
+      {
+        set->insert(set, &key, sizeof(int), &key, sizeof(int));
+      }
+
+      // walk the pairs forward and backward
+      int expected = 0;
+      struct kc_node_t* node = NULL;
+      for (set->first(set, &node); node != NULL; set->next(set, &node))
+      {
+        ok(*(int*)((struct kc_pair_t*)node->data)->key == expected++);
+      }
+      ok(expected == 50);
+
+      for (set->last(set, &node); node != NULL; set->prev(set, &node))
+      {
+        ok(*(int*)((struct kc_pair_t*)node->data)->key == --expected);
+      }
+      ok(expected == 0);
+
+      // check the bounds around an existing key
+      int key = 20;
+      set->lower_bound(set, &key, &node);
+      ok(*(int*)((struct kc_pair_t*)node->data)->key == 20);
+
+      set->upper_bound(set, &key, &node);
+      ok(*(int*)((struct kc_pair_t*)node->data)->key == 21);
+
+      key = 49;
+      set->upper_bound(set, &key, &node);
+      ok(node == NULL);
+
+      // count the pairs in [10, 30)
+      int low = 10;
+      int high = 30;
+      int count = 0;
+      ok(set->range(set, &low, &high, test_set_range_count, &count) == KC_SUCCESS);
+      ok(count == 20);
+
+      destroy_set(set);
+
+      // a set built from sorted keys holds the same pairs
+      int keys[50];
+      int values[50];
+      for (int i = 0; i < 50; ++i)
+      {
+        keys[i] = i;
+        values[i] = i;
+      }
+
+      set = new_set_from_sorted(set_compare_int, keys, values, 50, sizeof(int), sizeof(int));
+      ok(set != NULL);
+
+      expected = 0;
+      for (set->first(set, &node); node != NULL; set->next(set, &node))
+      {
+        ok(*(int*)((struct kc_pair_t*)node->data)->key == expected++);
+      }
+      ok(expected == 50);
+
+      key = 100;
+      ok(set->insert(set, &key, sizeof(int), &key, sizeof(int)) == KC_SUCCESS);
+
+      void* value = NULL;
+      key = 25;
+      set->search(set, &key, sizeof(int), &value);
+      ok(value != NULL && *(int*)value == 25);
+
+      count = 0;
+      set->range(set, &low, &high, test_set_range_count, &count);
+      ok(count == 20);
+
+      destroy_set(set);
+
+      // a hash set has no order
+      set = new_hash_set(NULL, set_compare_int);
+      ok(set->first(set, &node) == KC_INVALID);
+      ok(set->lower_bound(set, &key, &node) == KC_INVALID);
+      ok(set->range(set, &low, &high, test_set_range_count, &count) == KC_INVALID);
+
+      destroy_set(set);
+    }
+
+    done_testing()
+  }
+
+  testgroup("kc_tree_t")
+  {
+    subtest("test init/desc")
+    {
+      struct kc_tree_t* tree = new_tree(btree_compare_int);
+
+      ok(tree->root == NULL);
+
+      destroy_tree(tree);
+    }
+
+    subtest("test insert() & search()")
+    {
+      struct kc_tree_t* tree = new_tree(btree_compare_int);
+
+      int ret = KC_INVALID;
+
+      // insert 30 new nodes
+      for (int data = 0; data < 30; ++data)
+      {
+        ret = tree->insert(tree, &data, sizeof(int));
 
         ok(ret == KC_SUCCESS);
       }
@@ -1429,50 +2726,532 @@ int main() {
       struct kc_node_t* found_node3 = NULL;
       ret = tree->search(tree, data3, &found_node3);
 
-      ok(found_node1 != NULL);
-      ok(strcmp(found_node1->data, data1) == 0);
+      ok(found_node1 != NULL);
+      ok(strcmp(found_node1->data, data1) == 0);
+
+      ok(found_node2 != NULL);
+      ok(strcmp(found_node2->data, data2) == 0);
+
+      ok(found_node3 != NULL);
+      ok(strcmp(found_node3->data, data3) == 0);
+
+      destroy_tree(tree);
+    }
+
+    subtest("test custom compare")
+    {
+      struct kc_tree_t* tree = new_tree(test_tree_compare);
+
+      // create a new Pair
+      int key = 10, val = 100;
+      struct kc_pair_t* pair = pair_constructor(&key, sizeof(int), &val, sizeof(int));
+
+      int ret = KC_INVALID;
+
+      // insert the new pair
+      ret = tree->insert(tree, pair, sizeof(struct kc_pair_t));
+      ok(ret == KC_SUCCESS);
+
+      // check if the pair was inserted and found corectlly
+      struct kc_node_t* found_node = NULL;
+      ret = tree->search(tree, pair, &found_node);
+      ok(ret == KC_SUCCESS);
+
+      struct kc_pair_t* found_pair = (struct kc_pair_t*)found_node->data;
+
+      ok(found_pair != NULL);
+      ok(*(int*)found_pair->key == key);
+      ok(*(int*)found_pair->value == val);
+
+      // check the remove function
+      ret = tree->remove(tree, pair, sizeof(struct kc_pair_t));
+      ok(ret == KC_SUCCESS);
+      ok(tree->root == NULL);
+
+      pair_destructor(pair);
+      destroy_tree(tree);
+    }
+
+    subtest("test degenerate tree")
+    {
+      struct kc_tree_t* tree = new_tree(btree_compare_int);
+
+      int ret = KC_INVALID;
+
+      // sorted data turns a plain binary tree into a list
+      for (int data = 0; data < 10000; ++data)
+      {
+        ret = tree->insert(tree, &data, sizeof(int));
+      }
+
+      ok(ret == KC_SUCCESS);
+
+      int height = 0;
+      for (struct kc_node_t* node = tree->root; node != NULL; node = node->next)
+      {
+        ++height;
+      }
+      ok(height == 10000);
+
+      // remove a node deep down the tree
+      int data = 9990;
+      ok(tree->remove(tree, &data, sizeof(int)) == KC_SUCCESS);
+
+      struct kc_node_t* found_node = NULL;
+      tree->search(tree, &data, &found_node);
+      ok(found_node == NULL);
+
+      data = 9999;
+      tree->search(tree, &data, &found_node);
+      ok(found_node != NULL);
+
+      // the teardown must not depend on the height of the tree
+      destroy_tree(tree);
+    }
+
+    subtest("test red-black sorted insert")
+    {
+      struct kc_tree_t* tree = new_rb_tree(btree_compare_int);
+
+      int ret = KC_INVALID;
+
+      // insert sorted data, which would degenerate a plain binary tree
+      for (int data = 0; data < 1024; ++data)
+      {
+        ret = tree->insert(tree, &data, sizeof(int));
+
+        ok(ret == KC_SUCCESS);
+      }
+
+      // the root must be black and the red-black rules must hold
+      ok(((struct kc_tree_node_t*)tree->root)->red == false);
+      ok(test_rb_tree_black_height(tree->root, NULL) != -1);
+
+      // the height of the tree can't exceed 2 * log2(n + 1)
+      int height = 0;
+      for (struct kc_node_t* node = tree->root; node != NULL; node = node->next)
+      {
+        ++height;
+      }
+      ok(height <= 20);
+
+      // search for the newlly created nodes
+      for (int data = 0; data < 1024; ++data)
+      {
+        struct kc_node_t* found_node = NULL;
+        ret = tree->search(tree, &data, &found_node);
+
+        ok(ret == KC_SUCCESS);
+        ok(found_node != NULL);
+        ok(*(int*)found_node->data == data);
+      }
+
+      destroy_tree(tree);
+    }
+
+    subtest("test red-black remove")
+    {
+      struct kc_tree_t* tree = new_rb_tree(btree_compare_int);
+
+      int ret = KC_INVALID;
+
+      for (int data = 0; data < 512; ++data)
+      {
+        ret = tree->insert(tree, &data, sizeof(int));
+
+        ok(ret == KC_SUCCESS);
+      }
+
+      // remove all the even nodes, checking the rules after each removal
+      for (int data = 0; data < 512; data += 2)
+      {
+        ret = tree->remove(tree, &data, sizeof(int));
+
+        ok(ret == KC_SUCCESS);
+        ok(test_rb_tree_black_height(tree->root, NULL) != -1);
+      }
+
+      // only the odd nodes should be left
+      for (int data = 0; data < 512; ++data)
+      {
+        struct kc_node_t* found_node = NULL;
+        ret = tree->search(tree, &data, &found_node);
+
+        ok(ret == KC_SUCCESS);
+        ok((found_node != NULL) == (data % 2 == 1));
+      }
+
+      // remove the rest of the nodes in reverse
+      for (int data = 511; data > 0; data -= 2)
+      {
+        ret = tree->remove(tree, &data, sizeof(int));
+
+        ok(ret == KC_SUCCESS);
+        ok(test_rb_tree_black_height(tree->root, NULL) != -1);
+      }
+
+      ok(tree->root == NULL);
+
+      destroy_tree(tree);
+    }
+
+    subtest("test build from sorted")
+    {
+      int items[100];
+      for (int i = 0; i < 100; ++i)
+      {
+        items[i] = i * 3;
+      }
+
+      // every size must produce a valid red-black tree
+      for (size_t count = 0; count <= 100; ++count)
+      {
+        struct kc_tree_t* tree = new_tree_from_sorted(btree_compare_int, items, count, sizeof(int));
+
+        ok(tree != NULL);
+        ok(test_rb_tree_black_height(tree->root, NULL) != -1);
+        ok(tree->root == NULL || ((struct kc_tree_node_t*)tree->root)->red == false);
+
+        // all the items are in order
+        size_t visited = 0;
+        struct kc_node_t* node = NULL;
+        for (tree->first(tree, &node); node != NULL; tree->next(tree, &node))
+        {
+          ok(*(int*)node->data == items[visited++]);
+        }
+        ok(visited == count);
+
+        destroy_tree(tree);
+      }
+
+      // the tree stays balanced after more inserts and removes
+      struct kc_tree_t* tree = new_tree_from_sorted(btree_compare_int, items, 100, sizeof(int));
+
+      for (int data = 1; data < 300; data += 3)
+      {
+        tree->insert(tree, &data, sizeof(int));
+      }
+
+      for (int data = 0; data < 300; data += 6)
+      {
+        tree->remove(tree, &data, sizeof(int));
+      }
+
+      ok(test_rb_tree_black_height(tree->root, NULL) != -1);
+
+      destroy_tree(tree);
+
+      // unsorted items or duplicates are rejected
+      items[50] = items[49];
+      ok(new_tree_from_sorted(btree_compare_int, items, 100, sizeof(int)) == NULL);
+    }
+
+    subtest("test comparisons per level")
+    {
+      int items[1023];
+      for (int i = 0; i < 1023; ++i)
+      {
+        items[i] = i;
+      }
+
+      // a perfectly balanced tree of 1023 nodes has 10 levels
+      struct kc_tree_t* tree = new_tree_from_sorted(test_tree_counting_compare,
+        items, 1023, sizeof(int));
+
+      test_tree_compare_calls = 0;
+
+      for (int data = 0; data < 1023; ++data)
+      {
+        struct kc_node_t* found_node = NULL;
+        tree->search(tree, &data, &found_node);
+      }
+
+      // every search compares once per visited node at most
+      ok(test_tree_compare_calls <= 1023 * 10);
+
+      // a search on a missing data visits a whole path
+      test_tree_compare_calls = 0;
+
+      int data = 2000;
+      struct kc_node_t* found_node = NULL;
+      tree->search(tree, &data, &found_node);
+
+      ok(found_node == NULL);
+      ok(test_tree_compare_calls <= 10);
+
+      // an insert walks down the tree once too
+      test_tree_compare_calls = 0;
+      tree->insert(tree, &data, sizeof(int));
+      ok(test_tree_compare_calls <= 10);
+
+      destroy_tree(tree);
+    }
+
+    subtest("test rank() & select()")
+    {
+      int items[500];
+      for (int i = 0; i < 500; ++i)
+      {
+        items[i] = i * 2;
+      }
+
+      // start from a built tree, then change it with inserts and removes
+      struct kc_tree_t* tree = new_tree_from_sorted(btree_compare_int, items, 500, sizeof(int));
+
+      for (int data = 1; data < 1000; data += 4)
+      {
+        tree->insert(tree, &data, sizeof(int));
+      }
+
+      for (int data = 0; data < 1000; data += 8)
+      {
+        tree->remove(tree, &data, sizeof(int));
+      }
+
+      size_t length = 0;
+      ok(tree->length(tree, &length) == KC_SUCCESS);
+      ok(length == 500 + 250 - 125);
+
+      // the position of every node matches its rank
+      size_t index = 0;
+      struct kc_node_t* node = NULL;
+      for (tree->first(tree, &node); node != NULL; tree->next(tree, &node))
+      {
+        size_t rank = 0;
+        ok(tree->rank(tree, node->data, &rank) == KC_SUCCESS);
+        ok(rank == index);
+
+        struct kc_node_t* selected = NULL;
+        ok(tree->select(tree, index, &selected) == KC_SUCCESS);
+        ok(selected == node);
+
+        ++index;
+      }
+      ok(index == length);
+
+      // the rank of missing data counts the smaller items
+      int data = -5;
+      size_t rank = 42;
+      tree->rank(tree, &data, &rank);
+      ok(rank == 0);
+
+      data = 5000;
+      tree->rank(tree, &data, &rank);
+      ok(rank == length);
+
+      ok(tree->select(tree, length, &node) == KC_INDEX_OUT_OF_BOUNDS);
+
+      destroy_tree(tree);
+    }
+
+    subtest("test in-order iteration")
+    {
+      struct kc_tree_t* tree = new_tree(btree_compare_int);
+
+      // insert the even numbers up to 200 in a scrambled order
+      for (int i = 0; i < 101; ++i)
+      {
+        int data = (i * 37) % 101 * 2;
+        tree->insert(tree, &data, sizeof(int));
+      }
+
+      // walk the nodes forward and backward
+      int expected = 0;
+      struct kc_node_t* node = NULL;
+      for (tree->first(tree, &node); node != NULL; tree->next(tree, &node))
+      {
+        ok(*(int*)node->data == expected);
+        expected += 2;
+      }
+      ok(expected == 202);
+
+      for (tree->last(tree, &node); node != NULL; tree->prev(tree, &node))
+      {
+        expected -= 2;
+        ok(*(int*)node->data == expected);
+      }
+      ok(expected == 0);
+
+      // the bounds of a missing data point to the same node
+      int data = 51;
+      tree->lower_bound(tree, &data, &node);
+      ok(*(int*)node->data == 52);
+      tree->upper_bound(tree, &data, &node);
+      ok(*(int*)node->data == 52);
+
+      // the bounds of an existing data differ
+      data = 52;
+      tree->lower_bound(tree, &data, &node);
+      ok(*(int*)node->data == 52);
+      tree->upper_bound(tree, &data, &node);
+      ok(*(int*)node->data == 54);
+
+      data = 200;
+      tree->upper_bound(tree, &data, &node);
+      ok(node == NULL);
+
+      data = -1;
+      tree->lower_bound(tree, &data, &node);
+      ok(*(int*)node->data == 0);
+
+      // add up the data in [10, 20)
+      int low = 10;
+      int high = 20;
+      int sum[2] = { 0, 1000 };
+      ok(tree->range(tree, &low, &high, test_tree_range_sum, sum) == KC_SUCCESS);
+      ok(sum[0] == 10 + 12 + 14 + 16 + 18);
+
+      // the callback can stop the range early
+      sum[0] = 0;
+      sum[1] = 20;
+      tree->range(tree, &low, &high, test_tree_range_sum, sum);
+      ok(sum[0] == 10 + 12);
+
+      destroy_tree(tree);
+    }
+
+    done_testing()
+  }
+
+  testgroup("kc_bptree_t")
+  {
+    subtest("test init/desc")
+    {
+      struct kc_bptree_t* bptree = new_bptree(bptree_compare_int, sizeof(int));
+
+      ok(bptree != NULL);
+      ok(bptree->root != NULL);
+      ok(bptree->root->leaf == true);
+      ok(bptree->_length == 0);
+
+      destroy_bptree(bptree);
+
+      ok(new_bptree(bptree_compare_int, 0) == NULL);
+    }
+
+    subtest("test insert() & search()")
+    {
+      struct kc_bptree_t* bptree = new_bptree(bptree_compare_int, sizeof(int));
+
+      int ret = KC_INVALID;
+
+      // insert enough scrambled data to grow a few levels
+      for (int i = 0; i < 10007; ++i)
+      {
+        int data = (i * 7919) % 10007;
+        ret = bptree->insert(bptree, &data, sizeof(int));
+
+        ok(ret == KC_SUCCESS);
+      }
+
+      ok(bptree->root->leaf == false);
+
+      // inserting an existing item changes nothing
+      int data = 42;
+      ok(bptree->insert(bptree, &data, sizeof(int)) == KC_SUCCESS);
+
+      size_t length = 0;
+      ok(bptree->length(bptree, &length) == KC_SUCCESS);
+      ok(length == 10007);
+
+      // every item must be found
+      for (data = 0; data < 10007; ++data)
+      {
+        void* found = NULL;
+        ret = bptree->search(bptree, &data, &found);
+
+        ok(ret == KC_SUCCESS);
+        ok(found != NULL && *(int*)found == data);
+      }
+
+      void* found = &data;
+      data = 10007;
+      bptree->search(bptree, &data, &found);
+      ok(found == NULL);
+
+      // the items are stored inline, so the size must match
+      char letter = 'a';
+      ok(bptree->insert(bptree, &letter, sizeof(char)) == KC_INVALID);
+
+      destroy_bptree(bptree);
+    }
+
+    subtest("test range()")
+    {
+      struct kc_bptree_t* bptree = new_bptree(bptree_compare_int, sizeof(int));
+
+      for (int data = 1999; data >= 0; --data)
+      {
+        bptree->insert(bptree, &data, sizeof(int));
+      }
+
+      // count, previous item and order error
+      int state[3] = { 0, -1, 0 };
+      int low = 100;
+      int high = 1500;
 
-      ok(found_node2 != NULL);
-      ok(strcmp(found_node2->data, data2) == 0);
+      ok(bptree->range(bptree, &low, &high, test_bptree_range_count, state) == KC_SUCCESS);
+      ok(state[0] == 1400);
+      ok(state[1] == 1499);
+      ok(state[2] == 0);
 
-      ok(found_node3 != NULL);
-      ok(strcmp(found_node3->data, data3) == 0);
+      // an empty range doesn't call the callback
+      state[0] = 0;
+      low = 3000;
+      high = 4000;
+      bptree->range(bptree, &low, &high, test_bptree_range_count, state);
+      ok(state[0] == 0);
 
-      destroy_tree(tree);
+      destroy_bptree(bptree);
     }
 
-    subtest("test custom compare")
+    subtest("test remove()")
     {
-      struct kc_tree_t* tree = new_tree(test_tree_compare);
-
-      // create a new Pair
-      int key = 10, val = 100;
-      struct kc_pair_t* pair = pair_constructor(&key, sizeof(int), &val, sizeof(int));
+      struct kc_bptree_t* bptree = new_bptree(bptree_compare_int, sizeof(int));
 
       int ret = KC_INVALID;
 
-      // insert the new pair
-      ret = tree->insert(tree, pair, sizeof(struct kc_pair_t));
-      ok(ret == KC_SUCCESS);
+      for (int data = 0; data < 5000; ++data)
+      {
+        bptree->insert(bptree, &data, sizeof(int));
+      }
 
-      // check if the pair was inserted and found corectlly
-      struct kc_node_t* found_node = NULL;
-      ret = tree->search(tree, pair, &found_node);
-      ok(ret == KC_SUCCESS);
+      // remove the odd items
+      for (int data = 1; data < 5000; data += 2)
+      {
+        ret = bptree->remove(bptree, &data, sizeof(int));
 
-      struct kc_pair_t* found_pair = (struct kc_pair_t*)found_node->data;
+        ok(ret == KC_SUCCESS);
+      }
 
-      ok(found_pair != NULL);
-      ok(*(int*)found_pair->key == key);
-      ok(*(int*)found_pair->value == val);
+      size_t length = 0;
+      bptree->length(bptree, &length);
+      ok(length == 2500);
 
-      // check the remove function
-      ret = tree->remove(tree, pair, sizeof(struct kc_pair_t));
-      ok(ret == KC_SUCCESS);
-      ok(tree->root == NULL);
+      for (int data = 0; data < 5000; ++data)
+      {
+        void* found = NULL;
+        bptree->search(bptree, &data, &found);
 
-      pair_destructor(pair);
-      destroy_tree(tree);
+        ok((found != NULL) == (data % 2 == 0));
+      }
+
+      // removing a missing item changes nothing
+      int data = 1;
+      ok(bptree->remove(bptree, &data, sizeof(int)) == KC_SUCCESS);
+
+      // remove the rest of the items in reverse
+      for (data = 4998; data >= 0; data -= 2)
+      {
+        bptree->remove(bptree, &data, sizeof(int));
+      }
+
+      bptree->length(bptree, &length);
+      ok(length == 0);
+      ok(bptree->root->leaf == true);
+      ok(bptree->root->count == 0);
+
+      destroy_bptree(bptree);
     }
 
     done_testing()
@@ -1772,12 +3551,12 @@ int main() {
         }
       }
 
-      // if the length is less than half of the capacity,
-      // should resize the max_size to half
+      // the capacity is halved only once the length is less than a
+      // quarter of it
       size_t max_size = 0;
       ret = vector->max_size(vector, &max_size);
       ok(ret == KC_SUCCESS);
-      ok(max_size == 16);
+      ok(max_size == 32);
 
       // erase the last elements
       for (int i = 0; i < 10; ++i)
@@ -2121,6 +3900,199 @@ int main() {
       destroy_vector(vector);
     }
 
+    subtest("test append_n() & insert_range()")
+    {
+      struct kc_vector_t* vector = new_vector();
+      struct kc_vector_t* inline_vector = new_vector_of(sizeof(int));
+
+      int ret = KC_INVALID;
+
+      int numbers[1000];
+      for (int i = 0; i < 1000; ++i)
+      {
+        numbers[i] = i;
+      }
+
+      // append all the numbers at once, the capacity grows only once
+      ret = vector->append_n(vector, numbers, 1000, sizeof(int));
+      ok(ret == KC_SUCCESS);
+      ok(vector->length == 1000);
+      ok(vector->_capacity > 1000 && vector->_capacity <= 2000);
+
+      ret = inline_vector->append_n(inline_vector, numbers, 1000, sizeof(int));
+      ok(ret == KC_SUCCESS);
+      ok(inline_vector->length == 1000);
+
+      // insert ten negative numbers in the middle
+      int negatives[10];
+      for (int i = 0; i < 10; ++i)
+      {
+        negatives[i] = -i;
+      }
+
+      ret = vector->insert_range(vector, 500, negatives, 10, sizeof(int));
+      ok(ret == KC_SUCCESS);
+
+      ret = inline_vector->insert_range(inline_vector, 500, negatives, 10, sizeof(int));
+      ok(ret == KC_SUCCESS);
+
+      for (int i = 0; i < 1010; ++i)
+      {
+        int expected = i < 500 ? i : i < 510 ? -(i - 500) : i - 10;
+
+        ok(*(int*)vector->data[i] == expected);
+        ok(((int*)inline_vector->data)[i] == expected);
+      }
+
+      // the inline elements must have the same size and the index must
+      // be valid
+      long wrong[2] = { 1, 2 };
+      ok(inline_vector->append_n(inline_vector, wrong, 2, sizeof(long)) == KC_INVALID);
+      ok(vector->insert_range(vector, 1011, numbers, 2, sizeof(int)) == KC_INDEX_OUT_OF_BOUNDS);
+      ok(vector->length == 1010);
+
+      destroy_vector(vector);
+      destroy_vector(inline_vector);
+    }
+
+    subtest("test remove_if()")
+    {
+      struct kc_vector_t* vector = new_vector();
+      struct kc_vector_t* inline_vector = new_vector_of(sizeof(int));
+
+      int ret = KC_INVALID;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        vector->push_back(vector, &i, sizeof(int));
+        inline_vector->push_back(inline_vector, &i, sizeof(int));
+      }
+
+      // remove the multiples of three in a single pass
+      int divisor = 3;
+
+      ret = vector->remove_if(vector, test_vector_is_multiple, &divisor);
+      ok(ret == KC_SUCCESS);
+      ok(vector->length == 666);
+
+      ret = inline_vector->remove_if(inline_vector, test_vector_is_multiple, &divisor);
+      ok(ret == KC_SUCCESS);
+      ok(inline_vector->length == 666);
+
+      // the other elements keep their order
+      for (int i = 0; i < 666; ++i)
+      {
+        int expected = (i / 2) * 3 + (i % 2) + 1;
+
+        ok(*(int*)vector->data[i] == expected);
+        ok(((int*)inline_vector->data)[i] == expected);
+      }
+
+      // removing almost everything also releases the capacity
+      divisor = 1;
+
+      ret = vector->remove_if(vector, test_vector_is_multiple, &divisor);
+      ok(ret == KC_SUCCESS);
+      ok(vector->length == 0);
+      ok(vector->_capacity == 16);
+
+      destroy_vector(vector);
+      destroy_vector(inline_vector);
+    }
+
+    subtest("test reserve() & shrink_to_fit()")
+    {
+      struct kc_vector_t* vector = new_vector_of(sizeof(int));
+
+      int ret = KC_INVALID;
+
+      // reserve room for 1000 elements, a smaller one changes nothing
+      ret = vector->reserve(vector, 1000);
+      ok(ret == KC_SUCCESS);
+      ok(vector->_capacity == 1000);
+
+      ret = vector->reserve(vector, 10);
+      ok(ret == KC_SUCCESS);
+      ok(vector->_capacity == 1000);
+
+      // the buffer doesn't move while filling the reserved room
+      void* data = vector->data;
+      for (int i = 0; i < 900; ++i)
+      {
+        vector->push_back(vector, &i, sizeof(int));
+      }
+
+      ok(vector->data == data);
+
+      // release the unused room, the elements stay in order
+      for (int i = 0; i < 10; ++i)
+      {
+        vector->pop_front(vector);
+      }
+
+      ret = vector->shrink_to_fit(vector);
+      ok(ret == KC_SUCCESS);
+      ok(vector->_capacity == 890);
+      ok(vector->_front == 0);
+
+      for (int i = 0; i < 890; ++i)
+      {
+        ok(((int*)vector->data)[i] == i + 10);
+      }
+
+      destroy_vector(vector);
+    }
+
+    subtest("test resize hysteresis")
+    {
+      struct kc_vector_t* vector = new_vector_of(sizeof(int));
+
+      int ret = KC_INVALID;
+
+      // fill the vector right up to a power of two
+      for (int i = 0; i < 64; ++i)
+      {
+        vector->push_back(vector, &i, sizeof(int));
+      }
+
+      size_t capacity = vector->_capacity;
+
+      // pushing and popping around the same length keeps the capacity
+      for (int i = 0; i < 1000; ++i)
+      {
+        vector->pop_back(vector);
+        vector->pop_back(vector);
+        vector->push_back(vector, &i, sizeof(int));
+        vector->push_back(vector, &i, sizeof(int));
+
+        ok(vector->_capacity == capacity);
+      }
+
+      // the capacity is halved under a quarter of it
+      while (vector->length >= capacity / 4)
+      {
+        vector->pop_back(vector);
+      }
+
+      ok(vector->_capacity == capacity / 2);
+
+      // a different growth factor
+      ok(vector->set_growth(vector, 1.0) == KC_INVALID);
+
+      ret = vector->set_growth(vector, 1.5);
+      ok(ret == KC_SUCCESS);
+
+      capacity = vector->_capacity;
+      while (vector->_capacity == capacity)
+      {
+        vector->push_back(vector, &ret, sizeof(int));
+      }
+
+      ok(vector->_capacity == capacity + capacity / 2);
+
+      destroy_vector(vector);
+    }
+
     subtest("test search()")
     {
       // create a new instance of a vector
@@ -2193,6 +4165,207 @@ int main() {
       destroy_vector(vector);
     }
 
+    subtest("test new_vector_of()")
+    {
+      struct kc_vector_t* vector = new_vector_of(sizeof(int));
+
+      int ret = KC_INVALID;
+
+      ok(vector->length == 0);
+      ok(vector->_elem_size == sizeof(int));
+
+      // push enough items to grow the buffer
+      for (int i = 0; i < 100; ++i)
+      {
+        ret = vector->push_back(vector, &i, sizeof(int));
+        ok(ret == KC_SUCCESS);
+      }
+
+      // the elements are stored one after another
+      int* data = (int*)vector->data;
+      for (int i = 0; i < 100; ++i)
+      {
+        ok(data[i] == i);
+
+        void* at = NULL;
+        ret = vector->at(vector, i, &at);
+        ok(ret == KC_SUCCESS);
+        ok(at == &data[i]);
+      }
+
+      // elements of a different size are rejected
+      long wrong = 1;
+      ret = vector->push_back(vector, &wrong, sizeof(long));
+      ok(ret == KC_INVALID);
+      ok(vector->length == 100);
+
+      // insert and erase in the middle
+      int value = -1;
+      ret = vector->insert(vector, 50, &value, sizeof(int));
+      ok(ret == KC_SUCCESS);
+      ok(((int*)vector->data)[50] == -1);
+      ok(((int*)vector->data)[51] == 50);
+
+      ret = vector->erase(vector, 50);
+      ok(ret == KC_SUCCESS);
+      ok(((int*)vector->data)[50] == 50);
+
+      // remove by value and search
+      value = 10;
+      ret = vector->remove(vector, &value, test_vector_compare);
+      ok(ret == KC_SUCCESS);
+      ok(vector->length == 99);
+
+      bool exists = true;
+      ret = vector->search(vector, &value, test_vector_compare, &exists);
+      ok(ret == KC_SUCCESS);
+      ok(exists == false);
+
+      void* front = NULL;
+      void* back = NULL;
+      vector->front(vector, &front);
+      vector->back(vector, &back);
+      ok(*(int*)front == 0);
+      ok(*(int*)back == 99);
+
+      destroy_vector(vector);
+    }
+
+    subtest("test sliding window")
+    {
+      struct kc_vector_t* vector = new_vector_of(sizeof(int));
+
+      int ret = KC_INVALID;
+
+      // fill a window of 100 elements
+      for (int i = 0; i < 100; ++i)
+      {
+        vector->push_back(vector, &i, sizeof(int));
+      }
+
+      // slide it forward, the removed elements leave a gap at the front
+      // which is reused instead of growing the buffer
+      for (int i = 100; i < 10000; ++i)
+      {
+        ret = vector->push_back(vector, &i, sizeof(int));
+        ok(ret == KC_SUCCESS);
+
+        ret = vector->pop_front(vector);
+        ok(ret == KC_SUCCESS);
+
+        ok(((int*)vector->data)[0] == i - 99);
+        ok(((int*)vector->data)[99] == i);
+      }
+
+      ok(vector->length == 100);
+      ok(vector->_capacity <= 256);
+
+      // slide it backward, the pushed elements take the gap at the front
+      for (int i = 9899; i >= 0; --i)
+      {
+        ret = vector->push_front(vector, &i, sizeof(int));
+        ok(ret == KC_SUCCESS);
+
+        ret = vector->pop_back(vector);
+        ok(ret == KC_SUCCESS);
+
+        ok(((int*)vector->data)[0] == i);
+        ok(((int*)vector->data)[99] == i + 99);
+      }
+
+      ok(vector->length == 100);
+      ok(vector->_capacity <= 10000);
+
+      // the elements are still in order after growing at both ends
+      for (int i = 100; i < 200; ++i)
+      {
+        int value = -i;
+        vector->push_front(vector, &value, sizeof(int));
+        vector->push_back(vector, &i, sizeof(int));
+      }
+
+      int* data = (int*)vector->data;
+      for (int i = 0; i < 300; ++i)
+      {
+        int expected = i < 100 ? -(199 - i) : i - 100;
+        ok(data[i] == expected);
+      }
+
+      // clearing also removes the gap
+      vector->clear(vector);
+      ok(vector->_front == 0);
+      ok(vector->_capacity == 16);
+
+      destroy_vector(vector);
+    }
+
+    subtest("test small buffer")
+    {
+      struct kc_vector_t* vector = new_vector();
+      struct kc_vector_t* inline_vector = new_vector_of(sizeof(int));
+      struct kc_vector_t* large_vector = new_vector_of(64);
+
+      int ret = KC_INVALID;
+
+      // the first elements are stored inside the struct
+      ok(vector->data == vector->_small);
+      ok((void*)inline_vector->data == (void*)inline_vector->_small);
+      ok((void*)large_vector->data != (void*)large_vector->_small);
+
+      for (int i = 0; i < 15; ++i)
+      {
+        vector->push_back(vector, &i, sizeof(int));
+        inline_vector->push_back(inline_vector, &i, sizeof(int));
+      }
+
+      ok(vector->data == vector->_small);
+      ok((void*)inline_vector->data == (void*)inline_vector->_small);
+
+      // they move to the heap once they outgrow it
+      for (int i = 15; i < 100; ++i)
+      {
+        vector->push_back(vector, &i, sizeof(int));
+        inline_vector->push_back(inline_vector, &i, sizeof(int));
+      }
+
+      ok(vector->data != vector->_small);
+      ok((void*)inline_vector->data != (void*)inline_vector->_small);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        ok(*(int*)vector->data[i] == i);
+        ok(((int*)inline_vector->data)[i] == i);
+      }
+
+      // and move back once the capacity drops again
+      for (int i = 0; i < 95; ++i)
+      {
+        vector->pop_back(vector);
+        inline_vector->pop_back(inline_vector);
+      }
+
+      ok(vector->_capacity == 16);
+      ok(vector->data == vector->_small);
+      ok((void*)inline_vector->data == (void*)inline_vector->_small);
+
+      for (int i = 0; i < 5; ++i)
+      {
+        ok(*(int*)vector->data[i] == i);
+        ok(((int*)inline_vector->data)[i] == i);
+      }
+
+      // a gap in front of the elements also fits the small buffer
+      int value = -1;
+      ret = inline_vector->push_front(inline_vector, &value, sizeof(int));
+      ok(ret == KC_SUCCESS);
+      ok(((int*)inline_vector->data)[0] == -1);
+      ok(((int*)inline_vector->data)[5] == 4);
+
+      destroy_vector(vector);
+      destroy_vector(inline_vector);
+      destroy_vector(large_vector);
+    }
+
     done_testing()
   }
 